@@ -0,0 +1,53 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include <QQuickWindow>
+#include <QDebug>
+
+Benchmark::Benchmark( QQuickWindow* window )
+    : QObject( window )
+    , m_syncCount( 0 )
+    , m_syncTime( 0 )
+{
+    /*
+        beforeSynchronizing/afterSynchronizing might be emitted
+        from the render thread, while the GUI thread is blocked.
+     */
+    connect( window, &QQuickWindow::beforeSynchronizing,
+        this, &Benchmark::startSync, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::afterSynchronizing,
+        this, &Benchmark::endSync, Qt::DirectConnection );
+
+    m_reportTimer.start();
+    startTimer( 1000 );
+}
+
+void Benchmark::startSync()
+{
+    m_syncTimer.start();
+}
+
+void Benchmark::endSync()
+{
+    m_syncTime += m_syncTimer.nsecsElapsed();
+    m_syncCount++;
+}
+
+void Benchmark::timerEvent( QTimerEvent* )
+{
+    const auto count = m_syncCount.fetchAndStoreOrdered( 0 );
+    const auto nsecs = m_syncTime.fetchAndStoreOrdered( 0 );
+
+    const auto elapsed = m_reportTimer.restart();
+
+    const double updatesPerSecond = 1000.0 * count / qMax( elapsed, qint64( 1 ) );
+    const double usecsPerUpdate = count ? 0.001 * nsecs / count : 0.0;
+
+    qDebug() << "Updates/s:" << qRound( updatesPerSecond )
+        << "sync/update(us):" << qRound( usecsPerUpdate );
+}
@@ -0,0 +1,39 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <QObject>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+
+class QQuickWindow;
+
+/*
+    Counts the scene graph updates of a window and the time being spent
+    in the synchronization phase, where the nodes are updated.
+    The numbers are reported once per second.
+ */
+class Benchmark : public QObject
+{
+  public:
+    Benchmark( QQuickWindow* );
+
+  protected:
+    void timerEvent( QTimerEvent* ) override;
+
+  private:
+    void startSync();
+    void endSync();
+
+    QElapsedTimer m_syncTimer;
+    QElapsedTimer m_reportTimer;
+
+    QAtomicInteger< qint64 > m_syncCount;
+    QAtomicInteger< qint64 > m_syncTime;
+};
+
+#endif
@@ -26,6 +26,9 @@ QVector< QString > Speedometer::tickLabels() const
 void Speedometer::setTickLabels( const QVector< QString >& labels )
 {
     m_tickLabels = labels;
+
+    setStaticNodesDirty();
+    update();
 }
 
 #include "moc_Speedometer.cpp"
@@ -83,10 +83,24 @@ namespace
     };
 }
 
+static bool qskStaticNodesEnabled = true;
+
 SpeedometerSkinlet::SpeedometerSkinlet( QskSkin* skin )
     : QskSkinlet( skin )
 {
     setNodeRoles( { PanelRole, NeedleRole, KnobRole, LabelsRole } );
+
+    /*
+        Only the needle depends on the value. Panel, knob and the
+        labels have to be updated for geometry, skin or label changes only.
+     */
+    if ( qskStaticNodesEnabled )
+        setStaticNodeRoles( { PanelRole, KnobRole, LabelsRole } );
+}
+
+void SpeedometerSkinlet::setStaticNodesEnabled( bool on )
+{
+    qskStaticNodesEnabled = on;
 }
 
 QRectF SpeedometerSkinlet::subControlRect( const QskSkinnable* skinnable,
@@ -25,6 +25,9 @@ class SpeedometerSkinlet : public QskSkinlet
 
     Q_INVOKABLE SpeedometerSkinlet( QskSkin* skin = nullptr );
 
+    // for comparing the benchmark numbers
+    static void setStaticNodesEnabled( bool );
+
     QRectF subControlRect( const QskSkinnable*,
         const QRectF&, QskAspect::Subcontrol ) const override;
 
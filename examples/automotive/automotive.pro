@@ -1,6 +1,7 @@
 CONFIG += qskexample qskqvg
 
 HEADERS += \
+    Benchmark.h \
     ButtonBar.h \
     SkinFactory.h \
     MainWindow.h \
@@ -9,6 +10,7 @@ HEADERS += \
     SpeedometerDisplay.h
 
 SOURCES += \
+    Benchmark.cpp \
     ButtonBar.cpp \
     SkinFactory.cpp \
     MainWindow.cpp \
@@ -5,6 +5,8 @@
 
 #include "MainWindow.h"
 #include "SkinFactory.h"
+#include "SpeedometerSkinlet.h"
+#include "Benchmark.h"
 
 #include <SkinnyShortcut.h>
 #include <SkinnyFont.h>
@@ -13,7 +15,7 @@
 #include <QskSkinManager.h>
 #include <QskObjectCounter.h>
 
-#include <SkinnyShortcut.h>
+#include <QCommandLineParser>
 #include <QGuiApplication>
 
 int main( int argc, char** argv )
@@ -27,6 +29,21 @@ int main( int argc, char** argv )
 
     QGuiApplication app( argc, argv );
 
+    QCommandLineParser parser;
+    parser.addHelpOption();
+
+    const QCommandLineOption benchmarkOption( "benchmark",
+        "Report the number of scene graph updates per second" );
+    parser.addOption( benchmarkOption );
+
+    const QCommandLineOption noStaticOption( "no-static-nodes",
+        "Update all nodes of the speedometers for each value change" );
+    parser.addOption( noStaticOption );
+
+    parser.process( app );
+
+    SpeedometerSkinlet::setStaticNodesEnabled( !parser.isSet( noStaticOption ) );
+
     /*
         When going over QPainter for the SVGs we prefer the raster paint
         engine, simply showing better results.
@@ -37,6 +54,10 @@ int main( int argc, char** argv )
     SkinnyShortcut::enable( SkinnyShortcut::AllShortcuts );
 
     MainWindow window;
+
+    if ( parser.isSet( benchmarkOption ) )
+        ( void ) new Benchmark( &window );
+
     window.show();
 
     return app.exec();
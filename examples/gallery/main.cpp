@@ -13,9 +13,11 @@
 
 #include <QskFocusIndicator.h>
 #include <QskObjectCounter.h>
+#include <QskPrewarmer.h>
 #include <QskTabView.h>
 #include <QskWindow.h>
 
+#include <QDebug>
 #include <QGuiApplication>
 
 int main( int argc, char* argv[] )
@@ -51,5 +53,16 @@ int main( int argc, char* argv[] )
     window.resize( size );
     window.show();
 
+    /*
+        Creating skinlets, loading the shapes and fonts, while
+        the application is idle - before the other tabs are shown
+     */
+    QskPrewarmer prewarmer;
+#ifdef ITEM_STATISTICS
+    QObject::connect( &prewarmer, &QskPrewarmer::finished,
+        [ &prewarmer ]() { prewarmer.debugStatistics( qDebug() ); } );
+#endif
+    prewarmer.start();
+
     return app.exec();
 }
@@ -20,7 +20,10 @@
 #include <QskWindow.h>
 #include <QskShortcutMap.h>
 
+#include <QCommandLineParser>
+#include <QElapsedTimer>
 #include <QGuiApplication>
+#include <QDebug>
 
 class Label : public QskTextLabel
 {
@@ -34,13 +37,26 @@ class Label : public QskTextLabel
     }
 };
 
+class Page : public QskLinearBox
+{
+  public:
+    Page( const QString& text, QQuickItem* parent = nullptr )
+        : QskLinearBox( Qt::Horizontal, 5, parent )
+    {
+        // enough items to make the costs of creating a page measurable
+        for ( int i = 0; i < 25; i++ )
+            new Label( QStringLiteral( "%1\n%2" ).arg( text ).arg( i + 1 ), this );
+    }
+};
+
 class TabView : public QskTabView
 {
   public:
-    TabView( QQuickItem* parent = nullptr )
+    TabView( int pageCount, bool lazy, QQuickItem* parent = nullptr )
         : QskTabView( parent )
+        , m_lazy( lazy )
     {
-        for ( int i = 0; i < 10; i++ )
+        for ( int i = 0; i < pageCount; i++ )
         {
             QString text;
             if ( i == 4 )
@@ -48,17 +64,19 @@ class TabView : public QskTabView
             else
                 text = QString( "Tab %1" ).arg( i + 1 );
 
-            addTab( text, new Label( text ) );
+            addPage( text );
         }
 
-        buttonAt( 2 )->setEnabled( false );
-        setCurrentIndex( 4 );
+        if ( count() > 4 )
+        {
+            buttonAt( 2 )->setEnabled( false );
+            setCurrentIndex( 4 );
+        }
     }
 
     void appendTab()
     {
-        const auto text = QString( "Tab %1" ).arg( count() + 1 );
-        addTab( text, new Label( text ) );
+        addPage( QString( "Tab %1" ).arg( count() + 1 ) );
     }
 
     void removeLastTab()
@@ -67,6 +85,14 @@ class TabView : public QskTabView
             removeTab( count() - 1 );
     }
 
+    void addPage( const QString& text )
+    {
+        if ( m_lazy )
+            addTab( text, [text] { return new Page( text ); } );
+        else
+            addTab( text, new Page( text ) );
+    }
+
     void rotate()
     {
         const Qsk::Position pos[] = { Qsk::Top, Qsk::Right, Qsk::Bottom, Qsk::Left };
@@ -80,20 +106,47 @@ class TabView : public QskTabView
             }
         }
     }
+
+  private:
+    const bool m_lazy;
 };
 
 int main( int argc, char* argv[] )
 {
 #ifdef ITEM_STATISTICS
     QskObjectCounter counter( true );
+#else
+    QskObjectCounter counter;
 #endif
 
     QGuiApplication app( argc, argv );
 
+    QCommandLineParser parser;
+    parser.addHelpOption();
+
+    const QCommandLineOption lazyOption( "lazy",
+        "Create the pages, when being shown for the first time" );
+    parser.addOption( lazyOption );
+
+    const QCommandLineOption pagesOption( "pages",
+        "Number of pages", "count", "10" );
+    parser.addOption( pagesOption );
+
+    const QCommandLineOption unloadOption( "unload",
+        "Delete lazy pages, that have been hidden for <ms>", "ms", "0" );
+    parser.addOption( unloadOption );
+
+    parser.process( app );
+
     SkinnyFont::init( &app );
     SkinnyShortcut::enable( SkinnyShortcut::AllShortcuts );
 
-    auto tabView = new TabView();
+    QElapsedTimer timer;
+    timer.start();
+
+    auto tabView = new TabView( parser.value( pagesOption ).toInt(),
+        parser.isSet( lazyOption ) );
+    tabView->setUnloadTimeout( parser.value( unloadOption ).toInt() );
 
     auto rotateButton = new QskPushButton( "Rotate" );
     rotateButton->setFocus( true );
@@ -136,6 +189,21 @@ int main( int argc, char* argv[] )
     window.addItem( layoutBox );
     window.addItem( focusIndicator );
 
+    QObject::connect( &window, &QQuickWindow::frameSwapped, &window,
+        [&]()
+        {
+            static bool isFirstFrame = true;
+
+            if ( isFirstFrame )
+            {
+                isFirstFrame = false;
+
+                qDebug() << "Startup:" << timer.elapsed() << "ms,"
+                    << counter.current( QskObjectCounter::Items ) << "items,"
+                    << counter.current( QskObjectCounter::Objects ) << "objects";
+            }
+        }, Qt::QueuedConnection );
+
     window.show();
 
     for ( int i = 0; i < 10; i++ )
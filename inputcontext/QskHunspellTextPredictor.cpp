@@ -1,5 +1,5 @@
 #include "QskHunspellTextPredictor.h"
-#include <QVector>
+#include <QStringList>
 
 #include "hunspell.h"
 
@@ -7,7 +7,6 @@ class QskHunspellTextPredictor::PrivateData
 {
   public:
     Hunhandle* hunspellHandle;
-    QVector< QString > candidates;
 };
 
 QskHunspellTextPredictor::QskHunspellTextPredictor( QObject* object )
@@ -21,33 +20,22 @@ QskHunspellTextPredictor::QskHunspellTextPredictor( QObject* object )
         "/usr/share/hunspell/en_US.aff",
         "/usr/share/hunspell/en_US.dic" );
 #endif
+
+    /*
+        Hunspell_suggest is too slow to be called for each
+        keystroke from the GUI thread
+     */
+    setAsynchronous( true );
+    setDebounceInterval( 50 );
 }
 
 QskHunspellTextPredictor::~QskHunspellTextPredictor()
 {
+    finishRequests();
     Hunspell_destroy( m_data->hunspellHandle );
 }
 
-int QskHunspellTextPredictor::candidateCount() const
-{
-    return m_data->candidates.count();
-}
-
-QString QskHunspellTextPredictor::candidate( int pos ) const
-{
-    return m_data->candidates[ pos ];
-}
-
-void QskHunspellTextPredictor::reset()
-{
-    if ( !m_data->candidates.isEmpty() )
-    {
-        m_data->candidates.clear();
-        Q_EMIT predictionChanged();
-    }
-}
-
-void QskHunspellTextPredictor::request( const QString& text )
+QStringList QskHunspellTextPredictor::retrieveCandidates( const QString& text )
 {
     char** suggestions;
     const QByteArray word = text.toUtf8(); // ### do we need to check the encoding
@@ -55,7 +43,7 @@ void QskHunspellTextPredictor::request( const QString& text )
     const int count = Hunspell_suggest(
         m_data->hunspellHandle, &suggestions, word.constData() );
 
-    QVector< QString > candidates;
+    QStringList candidates;
     candidates.reserve( count );
 
     for ( int i = 0; i < count; i++ )
@@ -70,6 +58,5 @@ void QskHunspellTextPredictor::request( const QString& text )
 
     Hunspell_free_list( m_data->hunspellHandle, &suggestions, count );
 
-    m_data->candidates = candidates;
-    Q_EMIT predictionChanged();
+    return candidates;
 }
@@ -18,12 +18,8 @@ class QSK_INPUTCONTEXT_EXPORT QskHunspellTextPredictor : public QskTextPredictor
     QskHunspellTextPredictor( QObject* = nullptr );
     ~QskHunspellTextPredictor() override;
 
-    int candidateCount() const override;
-    QString candidate( int pos ) const override;
-
   protected:
-    void request( const QString& ) override;
-    void reset() override;
+    QStringList retrieveCandidates( const QString& ) override;
 
   private:
     class PrivateData;
@@ -11,15 +11,8 @@
 #include <QDebug>
 #include <QStringList>
 
-class QskPinyinTextPredictor::PrivateData
-{
-  public:
-    QStringList candidates;
-};
-
 QskPinyinTextPredictor::QskPinyinTextPredictor( QObject* parent )
     : Inherited( Attributes(), parent )
-    , m_data( new PrivateData )
 {
 #if 1
     const char dictionary[] = "XXX/3rdparty/pinyin/data/dict_pinyin.dat";
@@ -36,42 +29,24 @@ QskPinyinTextPredictor::QskPinyinTextPredictor( QObject* parent )
 
 QskPinyinTextPredictor::~QskPinyinTextPredictor()
 {
+    finishRequests();
     ime_pinyin::im_close_decoder();
 }
 
-int QskPinyinTextPredictor::candidateCount() const
-{
-    return m_data->candidates.count();
-}
-
-QString QskPinyinTextPredictor::candidate( int index ) const
-{
-    if ( ( index >= 0 ) && ( index < m_data->candidates.count() ) )
-        return m_data->candidates[ index ];
-
-    return QString();
-}
-
-void QskPinyinTextPredictor::reset()
-{
-    ime_pinyin::im_reset_search();
-
-    if ( !m_data->candidates.isEmpty() )
-    {
-        m_data->candidates.clear();
-        Q_EMIT predictionChanged();
-    }
-}
-
-void QskPinyinTextPredictor::request( const QString& text )
+QStringList QskPinyinTextPredictor::retrieveCandidates( const QString& text )
 {
+    /*
+        im_search compares the spelling with the one of the previous
+        search and continues incrementally, when possible. So there
+        is no need for calling im_reset_search.
+     */
     const QByteArray bytes = text.toLatin1();
 
     size_t count = ime_pinyin::im_search(
         bytes.constData(), size_t( bytes.length() ) );
 
     if ( count <= 0 )
-        return;
+        return QStringList();
 
     const size_t maxCount = 20;
     if ( count > maxCount )
@@ -99,6 +74,5 @@ void QskPinyinTextPredictor::request( const QString& text )
         candidates += candidate;
     }
 
-    m_data->candidates = candidates;
-    Q_EMIT predictionChanged();
+    return candidates;
 }
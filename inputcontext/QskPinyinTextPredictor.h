@@ -8,7 +8,6 @@
 
 #include "QskInputContextGlobal.h"
 #include <QskTextPredictor.h>
-#include <memory>
 
 class QSK_INPUTCONTEXT_EXPORT QskPinyinTextPredictor : public QskTextPredictor
 {
@@ -18,16 +17,8 @@ class QSK_INPUTCONTEXT_EXPORT QskPinyinTextPredictor : public QskTextPredictor
     QskPinyinTextPredictor( QObject* = nullptr );
     ~QskPinyinTextPredictor() override;
 
-    int candidateCount() const override;
-    QString candidate( int ) const override;
-
   protected:
-    void request( const QString& ) override;
-    void reset() override;
-
-  private:
-    class PrivateData;
-    std::unique_ptr< PrivateData > m_data;
+    QStringList retrieveCandidates( const QString& ) override;
 };
 
 #endif
@@ -30,15 +30,15 @@ class AnchorBox : public QskControl
         Qt::Orientations = Qt::Horizontal | Qt::Vertical );
 
   protected:
+    bool event( QEvent* ) override;
+    void itemChange( ItemChange, const ItemChangeData& ) override;
+
     void geometryChangeEvent( QskGeometryChangeEvent* ) override;
     void updateLayout() override;
 
     QSizeF layoutSizeHint( Qt::SizeHint, const QSizeF& ) const override;
 
   private:
-    void updateHints();
-    void updateGeometries( const QRectF& );
-
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -0,0 +1,554 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "AnchorLayoutEngine.h"
+
+#include "kiwi/Solver.h"
+#include "kiwi/Constraint.h"
+#include "kiwi/Variable.h"
+#include "kiwi/Expression.h"
+
+#include <QskQuick.h>
+
+#include <qhash.h>
+#include <qvector.h>
+
+#include <limits>
+#include <vector>
+
+/*
+     The solver seems to run into overflows with
+     std::numeric_limits< unsigned float >::max()
+ */
+static const qreal qskMaxSize = std::numeric_limits< unsigned int >::max();
+
+static inline Qt::Orientation qskOrientation( int edge )
+{
+    return ( edge <= Qt::AnchorRight ) ? Qt::Horizontal : Qt::Vertical;
+}
+
+namespace
+{
+    class Geometry
+    {
+      public:
+        Expression expressionAt( int anchorPoint ) const
+        {
+            switch( anchorPoint )
+            {
+                case Qt::AnchorLeft:
+                    return Term( m_left );
+
+                case Qt::AnchorHorizontalCenter:
+                    return m_left + 0.5 * m_width;
+
+                case Qt::AnchorRight:
+                    return m_left + m_width;
+
+                case Qt::AnchorTop:
+                    return Term( m_top );
+
+                case Qt::AnchorVerticalCenter:
+                    return m_top + 0.5 * m_height;
+
+                case Qt::AnchorBottom:
+                    return m_top + m_height;
+            }
+
+            return Expression();
+        }
+
+        inline const Variable& length( Qt::Orientation orientation ) const
+        {
+            return ( orientation == Qt::Horizontal ) ? m_width : m_height;
+        }
+
+        inline QRectF rect() const
+        {
+            return QRectF( m_left.value(), m_top.value(),
+                m_width.value(), m_height.value() );
+        }
+
+      private:
+        Variable m_left, m_top, m_width, m_height;
+    };
+
+    class Anchor
+    {
+      public:
+        QQuickItem* item1 = nullptr;
+        Qt::AnchorPoint edge1;
+
+        QQuickItem* item2 = nullptr;
+        Qt::AnchorPoint edge2;
+    };
+
+    class Hints
+    {
+      public:
+        inline bool operator==( const Hints& other ) const
+        {
+            return ( minimum == other.minimum ) && ( preferred == other.preferred )
+                && ( maximum == other.maximum );
+        }
+
+        QSizeF minimum;
+        QSizeF preferred;
+        QSizeF maximum;
+    };
+
+    class SolverItem
+    {
+      public:
+        Geometry geometry;
+
+        Hints hints;
+        std::vector< Constraint > sizeConstraints;
+    };
+
+    class LayoutSolver : public Solver
+    {
+      public:
+        LayoutSolver( bool stretch )
+            : m_stretch( stretch )
+        {
+        }
+
+        void addItem( QQuickItem* );
+        bool updateItem( int index, QQuickItem* );
+
+        void addAnchor( const Anchor&, int index1, int index2 );
+
+        // negative values: not suggesting a value
+        QSizeF resolve( qreal width, qreal height );
+
+        inline QRectF geometryAt( int index ) const
+        {
+            return m_items[ index ].geometry.rect();
+        }
+
+      private:
+        void setEditing( const Variable&, bool& isEditing, qreal value );
+
+        void addSizeConstraints( SolverItem&, const QSizeF&,
+            RelationalOperator, double strength );
+
+        void setSizeConstraints( SolverItem&, const Hints& );
+
+        const bool m_stretch;
+
+        Variable m_width, m_height;
+        bool m_isEditing[ 2 ] = { false, false };
+
+        QVector< SolverItem > m_items;
+    };
+}
+
+static inline Hints qskItemHints( const QQuickItem* item )
+{
+    Hints hints;
+    hints.minimum = qskSizeConstraint( item, Qt::MinimumSize );
+    hints.preferred = qskSizeConstraint( item, Qt::PreferredSize );
+    hints.maximum = qskSizeConstraint( item, Qt::MaximumSize );
+
+    return hints;
+}
+
+void LayoutSolver::addItem( QQuickItem* item )
+{
+    SolverItem solverItem;
+    setSizeConstraints( solverItem, qskItemHints( item ) );
+
+    m_items += solverItem;
+}
+
+bool LayoutSolver::updateItem( int index, QQuickItem* item )
+{
+    const auto hints = qskItemHints( item );
+
+    auto& solverItem = m_items[ index ];
+    if ( hints == solverItem.hints )
+        return false;
+
+    for ( const auto& constraint : solverItem.sizeConstraints )
+        removeConstraint( constraint );
+
+    solverItem.sizeConstraints.clear();
+    setSizeConstraints( solverItem, hints );
+
+    return true;
+}
+
+void LayoutSolver::setSizeConstraints( SolverItem& solverItem, const Hints& hints )
+{
+    solverItem.hints = hints;
+
+    addSizeConstraints( solverItem, hints.minimum, OP_GE, Strength::required );
+    addSizeConstraints( solverItem, hints.maximum, OP_LE, Strength::required );
+    addSizeConstraints( solverItem, hints.preferred, OP_EQ, Strength::strong );
+}
+
+void LayoutSolver::addSizeConstraints( SolverItem& solverItem,
+    const QSizeF& size, RelationalOperator op, double strength )
+{
+    const auto& geometry = solverItem.geometry;
+
+    if ( size.width() >= 0.0 )
+    {
+        const Constraint c( geometry.length( Qt::Horizontal ) - size.width(), op, strength );
+
+        addConstraint( c );
+        solverItem.sizeConstraints.push_back( c );
+    }
+
+    if ( size.height() >= 0.0 )
+    {
+        const Constraint c( geometry.length( Qt::Vertical ) - size.height(), op, strength );
+
+        addConstraint( c );
+        solverItem.sizeConstraints.push_back( c );
+    }
+}
+
+void LayoutSolver::addAnchor( const Anchor& anchor, int index1, int index2 )
+{
+    const auto& r1 = m_items[ index1 ].geometry;
+    const auto expr1 = r1.expressionAt( anchor.edge1 );
+
+    if ( index2 < 0 )
+    {
+        Expression expr2;
+
+        switch( anchor.edge2 )
+        {
+            case Qt::AnchorLeft:
+            case Qt::AnchorTop:
+                expr2 = 0;
+                break;
+
+            case Qt::AnchorHorizontalCenter:
+                expr2 = Term( 0.5 * m_width );
+                break;
+
+            case Qt::AnchorRight:
+                expr2 = Term( m_width );
+                break;
+
+            case Qt::AnchorVerticalCenter:
+                expr2 = Term( 0.5 * m_height );
+                break;
+
+            case Qt::AnchorBottom:
+                expr2 = Term( m_height );
+                break;
+        }
+
+        addConstraint( expr1 == expr2 );
+    }
+    else
+    {
+        const auto& r2 = m_items[ index2 ].geometry;
+        addConstraint( expr1 == r2.expressionAt( anchor.edge2 ) );
+
+        if ( m_stretch )
+        {
+            const auto o = qskOrientation( anchor.edge1 );
+
+            /*
+                A constraint with medium strength to make anchored item
+                being stretched according to their stretch factors s1, s2.
+                ( For the moment we don't support having specific factors. )
+             */
+            const auto s1 = 1.0;
+            const auto s2 = 1.0;
+
+            const Constraint c( r1.length( o ) * s1 == r2.length( o ) * s2, Strength::medium );
+            addConstraint( c );
+        }
+    }
+}
+
+void LayoutSolver::setEditing( const Variable& variable, bool& isEditing, qreal value )
+{
+    const bool on = ( value >= 0.0 );
+
+    if ( on != isEditing )
+    {
+        if ( on )
+            addEditVariable( variable, 0.9 * Strength::required );
+        else
+            removeEditVariable( variable );
+
+        isEditing = on;
+    }
+
+    if ( on )
+        suggestValue( variable, value );
+}
+
+QSizeF LayoutSolver::resolve( qreal width, qreal height )
+{
+    setEditing( m_width, m_isEditing[ 0 ], width );
+    setEditing( m_height, m_isEditing[ 1 ], height );
+
+    updateVariables();
+
+    return QSizeF( m_width.value(), m_height.value() );
+}
+
+namespace
+{
+    class HintEntry
+    {
+      public:
+        Qt::SizeHint which;
+        QSizeF constraint;
+        QSizeF hint;
+    };
+}
+
+class AnchorLayoutEngine::PrivateData
+{
+  public:
+    void setupSolver( LayoutSolver* solver ) const
+    {
+        for ( auto item : items )
+            solver->addItem( item );
+
+        for ( const auto& anchor : anchors )
+            addAnchor( solver, anchor );
+    }
+
+    void addAnchor( LayoutSolver* solver, const Anchor& anchor ) const
+    {
+        const int index2 = anchor.item2 ? indexes.value( anchor.item2 ) : -1;
+        solver->addAnchor( anchor, indexes.value( anchor.item1 ), index2 );
+    }
+
+    LayoutSolver* hintSolver() const
+    {
+        if ( m_hintSolver == nullptr )
+        {
+            m_hintSolver.reset( new LayoutSolver( false ) );
+            setupSolver( m_hintSolver.get() );
+        }
+
+        return m_hintSolver.get();
+    }
+
+    LayoutSolver* layoutSolver() const
+    {
+        if ( m_layoutSolver == nullptr )
+        {
+            m_layoutSolver.reset( new LayoutSolver( true ) );
+            setupSolver( m_layoutSolver.get() );
+
+            layoutSize = QSizeF();
+        }
+
+        return m_layoutSolver.get();
+    }
+
+    void resetSolvers()
+    {
+        m_hintSolver.reset();
+        m_layoutSolver.reset();
+
+        hintCache.clear();
+    }
+
+    QVector< QQuickItem* > items;
+    QHash< const QQuickItem*, int > indexes;
+
+    QVector< Anchor > anchors;
+
+    mutable QVector< HintEntry > hintCache;
+    mutable QSizeF layoutSize;
+
+    mutable std::unique_ptr< LayoutSolver > m_hintSolver;
+    mutable std::unique_ptr< LayoutSolver > m_layoutSolver;
+};
+
+AnchorLayoutEngine::AnchorLayoutEngine()
+    : m_data( new PrivateData() )
+{
+}
+
+AnchorLayoutEngine::~AnchorLayoutEngine()
+{
+}
+
+void AnchorLayoutEngine::addAnchor( QQuickItem* item1, Qt::AnchorPoint edge1,
+    QQuickItem* item2, Qt::AnchorPoint edge2 )
+{
+    auto& d = *m_data;
+
+    for ( auto item : { item1, item2 } )
+    {
+        if ( item && !d.indexes.contains( item ) )
+        {
+            d.indexes.insert( item, d.items.count() );
+            d.items += item;
+
+            if ( d.m_hintSolver )
+                d.m_hintSolver->addItem( item );
+
+            if ( d.m_layoutSolver )
+                d.m_layoutSolver->addItem( item );
+        }
+    }
+
+    Anchor anchor;
+    anchor.item1 = item1;
+    anchor.edge1 = edge1;
+    anchor.item2 = item2;
+    anchor.edge2 = edge2;
+
+    d.anchors += anchor;
+
+    // the existing solvers are extended instead of being rebuilt
+
+    if ( d.m_hintSolver )
+        d.addAnchor( d.m_hintSolver.get(), anchor );
+
+    if ( d.m_layoutSolver )
+    {
+        d.addAnchor( d.m_layoutSolver.get(), anchor );
+        d.layoutSize = QSizeF();
+    }
+
+    d.hintCache.clear();
+}
+
+void AnchorLayoutEngine::removeItem( const QQuickItem* item )
+{
+    auto& d = *m_data;
+
+    const int index = d.indexes.value( item, -1 );
+    if ( index < 0 )
+        return;
+
+    d.items.removeAt( index );
+
+    d.indexes.clear();
+    for ( int i = 0; i < d.items.count(); i++ )
+        d.indexes.insert( d.items[ i ], i );
+
+    for ( int i = d.anchors.count() - 1; i >= 0; i-- )
+    {
+        const auto& anchor = d.anchors[ i ];
+        if ( anchor.item1 == item || anchor.item2 == item )
+            d.anchors.removeAt( i );
+    }
+
+    // not worth to support removing constraints from the solvers
+
+    d.resetSolvers();
+}
+
+int AnchorLayoutEngine::count() const
+{
+    return m_data->items.count();
+}
+
+QQuickItem* AnchorLayoutEngine::itemAt( int index ) const
+{
+    return m_data->items.value( index, nullptr );
+}
+
+int AnchorLayoutEngine::indexOf( const QQuickItem* item ) const
+{
+    return m_data->indexes.value( item, -1 );
+}
+
+void AnchorLayoutEngine::invalidate()
+{
+    auto& d = *m_data;
+
+    for ( int i = 0; i < d.items.count(); i++ )
+    {
+        if ( d.m_hintSolver )
+            d.m_hintSolver->updateItem( i, d.items[ i ] );
+
+        if ( d.m_layoutSolver )
+        {
+            if ( d.m_layoutSolver->updateItem( i, d.items[ i ] ) )
+                d.layoutSize = QSizeF();
+        }
+    }
+
+    d.hintCache.clear();
+}
+
+QSizeF AnchorLayoutEngine::sizeHint(
+    Qt::SizeHint which, const QSizeF& constraint ) const
+{
+    auto& d = *m_data;
+
+    if ( which < Qt::MinimumSize || which > Qt::MaximumSize )
+        return QSizeF();
+
+    for ( const auto& entry : qskAsConst( d.hintCache ) )
+    {
+        if ( entry.which == which && entry.constraint == constraint )
+            return entry.hint;
+    }
+
+    qreal width = -1.0;
+    qreal height = -1.0;
+
+    if ( which == Qt::MinimumSize )
+        width = height = 0.0;
+    else if ( which == Qt::MaximumSize )
+        width = height = qskMaxSize;
+
+    if ( constraint.width() >= 0.0 )
+        width = constraint.width();
+
+    if ( constraint.height() >= 0.0 )
+        height = constraint.height();
+
+    auto hint = d.hintSolver()->resolve( width, height );
+
+    if ( constraint.width() >= 0.0 )
+        hint.setWidth( -1.0 );
+
+    if ( constraint.height() >= 0.0 )
+        hint.setHeight( -1.0 );
+
+    // a couple of constraints are usually requested again and again
+
+    if ( d.hintCache.count() >= 8 )
+        d.hintCache.removeFirst();
+
+    HintEntry entry;
+    entry.which = which;
+    entry.constraint = constraint;
+    entry.hint = hint;
+
+    d.hintCache += entry;
+
+    return hint;
+}
+
+void AnchorLayoutEngine::setGeometries( const QRectF& rect )
+{
+    auto& d = *m_data;
+
+    auto solver = d.layoutSolver();
+
+    if ( rect.size() != d.layoutSize )
+    {
+        // warm started: only the suggested values have changed
+        solver->resolve( rect.width(), rect.height() );
+        d.layoutSize = rect.size();
+    }
+
+    for ( int i = 0; i < d.items.count(); i++ )
+    {
+        const auto r = solver->geometryAt( i ).translated( rect.left(), rect.top() );
+        qskSetItemGeometry( d.items[ i ], r );
+    }
+}
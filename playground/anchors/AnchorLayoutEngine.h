@@ -0,0 +1,53 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef ANCHOR_LAYOUT_ENGINE_H
+#define ANCHOR_LAYOUT_ENGINE_H
+
+#include <QskGlobal.h>
+
+#include <qnamespace.h>
+#include <qrect.h>
+#include <memory>
+
+class QQuickItem;
+
+/*
+    AnchorLayoutEngine keeps its constraint solvers alive between
+    the layout passes. Resizing only suggests new values for the size of
+    the layout rectangle, changing the hints of the items replaces
+    the size constraints of these items, and new anchors are
+    added incrementally. Only removing items requires to start over.
+ */
+class AnchorLayoutEngine
+{
+  public:
+    AnchorLayoutEngine();
+    ~AnchorLayoutEngine();
+
+    // item2 == nullptr: anchoring to the layout rectangle
+    void addAnchor( QQuickItem* item1, Qt::AnchorPoint,
+        QQuickItem* item2, Qt::AnchorPoint );
+
+    void removeItem( const QQuickItem* );
+
+    int count() const;
+    QQuickItem* itemAt( int index ) const;
+    int indexOf( const QQuickItem* ) const;
+
+    // the size hints of the items have changed
+    void invalidate();
+
+    QSizeF sizeHint( Qt::SizeHint, const QSizeF& constraint ) const;
+    void setGeometries( const QRectF& );
+
+  private:
+    Q_DISABLE_COPY( AnchorLayoutEngine )
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
@@ -14,8 +14,10 @@ SOURCES += \
     kiwi/Solver.cpp
 
 HEADERS += \
-    AnchorBox.h
+    AnchorBox.h \
+    AnchorLayoutEngine.h
 
 SOURCES += \
     AnchorBox.cpp \
+    AnchorLayoutEngine.cpp \
     main.cpp
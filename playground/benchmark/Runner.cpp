@@ -0,0 +1,233 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include "Runner.h"
+#include "Scenario.h"
+
+#include <QskWindow.h>
+
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QSGGeometryNode>
+#include <QVector>
+
+#include <algorithm>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickitem_p.h>
+QSK_QT_PRIVATE_END
+
+namespace
+{
+    class Sample
+    {
+      public:
+        qint64 update = 0; // modifications done by the scenario
+        qint64 polish = 0; // polishing/layouting of the items
+        qint64 sync = 0;   // updating the scene graph nodes
+        qint64 render = 0; // rendering the scene graph
+        qint64 frame = 0;  // all from polish to render
+    };
+
+    class NodeStatistics
+    {
+      public:
+        int nodes = 0;
+        int geometryNodes = 0;
+        int vertices = 0;
+        int indices = 0;
+    };
+}
+
+static void qskCountNodes( const QSGNode* node, NodeStatistics& statistics )
+{
+    statistics.nodes++;
+
+    if ( node->type() == QSGNode::GeometryNodeType )
+    {
+        statistics.geometryNodes++;
+
+        const auto geometryNode = static_cast< const QSGGeometryNode* >( node );
+        if ( const auto geometry = geometryNode->geometry() )
+        {
+            statistics.vertices += geometry->vertexCount();
+            statistics.indices += geometry->indexCount();
+        }
+    }
+
+    for ( auto child = node->firstChild(); child; child = child->nextSibling() )
+        qskCountNodes( child, statistics );
+}
+
+static QJsonObject qskNodeStatistics( const QskWindow* window )
+{
+    NodeStatistics statistics;
+
+    const auto d = QQuickItemPrivate::get( window->contentItem() );
+    if ( d->itemNodeInstance )
+        qskCountNodes( d->itemNodeInstance, statistics );
+
+    QJsonObject object;
+    object[ "nodes" ] = statistics.nodes;
+    object[ "geometryNodes" ] = statistics.geometryNodes;
+    object[ "vertices" ] = statistics.vertices;
+    object[ "indices" ] = statistics.indices;
+
+    return object;
+}
+
+static QJsonObject qskTimings( QVector< qint64 > values )
+{
+    // in ms
+
+    QJsonObject object;
+
+    if ( values.isEmpty() )
+        return object;
+
+    std::sort( values.begin(), values.end() );
+
+    qint64 sum = 0;
+    for ( const auto value : qAsConst( values ) )
+        sum += value;
+
+    const int n = values.count();
+
+    object[ "min" ] = values.first() / 1e6;
+    object[ "median" ] = values[ n / 2 ] / 1e6;
+    object[ "mean" ] = sum / 1e6 / n;
+    object[ "p95" ] = values[ qMin( n - 1, n * 95 / 100 ) ] / 1e6;
+    object[ "max" ] = values.last() / 1e6;
+
+    return object;
+}
+
+static QJsonObject qskObjectStatistics(
+    const QskObjectCounter& counter, QskObjectCounter::ObjectType type )
+{
+    QJsonObject object;
+    object[ "created" ] = counter.created( type );
+    object[ "destroyed" ] = counter.destroyed( type );
+    object[ "maximum" ] = counter.maximum( type );
+
+    return object;
+}
+
+Runner::Runner( QskWindow* window )
+    : m_window( window )
+    , m_counter( false )
+{
+    m_counter.setActive( false );
+    m_clock.start();
+
+    /*
+        With the software backend and the basic render loop
+        all signals are emitted in the GUI thread.
+     */
+    QObject::connect( window, &QQuickWindow::beforeSynchronizing,
+        [ this ]() { m_beforeSynchronizing = m_clock.nsecsElapsed(); } );
+
+    QObject::connect( window, &QQuickWindow::afterSynchronizing,
+        [ this ]() { m_afterSynchronizing = m_clock.nsecsElapsed(); } );
+
+    QObject::connect( window, &QQuickWindow::beforeRendering,
+        [ this ]() { m_beforeRendering = m_clock.nsecsElapsed(); } );
+
+    QObject::connect( window, &QQuickWindow::afterRendering,
+        [ this ]() { m_afterRendering = m_clock.nsecsElapsed(); } );
+}
+
+void Runner::setFrames( int warmup, int measured )
+{
+    m_warmupFrames = qMax( warmup, 0 );
+    m_frames = qMax( measured, 1 );
+}
+
+QJsonObject Runner::run( Scenario* scenario )
+{
+    QVector< qint64 > timings[ 5 ];
+
+    scenario->setup( m_window );
+    renderFrame();
+
+    m_counter.reset();
+    m_counter.setActive( true );
+
+    for ( int i = 0; i < m_warmupFrames + m_frames; i++ )
+    {
+        Sample sample;
+
+        const auto t0 = m_clock.nsecsElapsed();
+
+        scenario->step( m_window, i );
+
+        // the posted layout requests, polish events ...
+        QCoreApplication::sendPostedEvents();
+
+        const auto t1 = m_clock.nsecsElapsed();
+
+        m_beforeSynchronizing = m_afterSynchronizing = -1;
+        m_beforeRendering = m_afterRendering = -1;
+
+        renderFrame();
+
+        const auto t2 = m_clock.nsecsElapsed();
+
+        if ( i < m_warmupFrames )
+            continue;
+
+        sample.update = t1 - t0;
+        sample.frame = t2 - t1;
+
+        if ( m_beforeSynchronizing >= 0 )
+        {
+            sample.polish = m_beforeSynchronizing - t1;
+            sample.sync = m_afterSynchronizing - m_beforeSynchronizing;
+        }
+
+        if ( m_beforeRendering >= 0 )
+            sample.render = m_afterRendering - m_beforeRendering;
+
+        timings[ 0 ] += sample.update;
+        timings[ 1 ] += sample.polish;
+        timings[ 2 ] += sample.sync;
+        timings[ 3 ] += sample.render;
+        timings[ 4 ] += sample.frame;
+    }
+
+    m_counter.setActive( false );
+
+    const auto nodeStatistics = qskNodeStatistics( m_window );
+
+    scenario->cleanup( m_window );
+    renderFrame();
+
+    QJsonObject phases;
+    phases[ "update" ] = qskTimings( timings[ 0 ] );
+    phases[ "polish" ] = qskTimings( timings[ 1 ] );
+    phases[ "sync" ] = qskTimings( timings[ 2 ] );
+    phases[ "render" ] = qskTimings( timings[ 3 ] );
+    phases[ "frame" ] = qskTimings( timings[ 4 ] );
+
+    QJsonObject result;
+    result[ "name" ] = scenario->name();
+    result[ "frames" ] = m_frames;
+    result[ "phases" ] = phases;
+    result[ "sceneGraph" ] = nodeStatistics;
+    result[ "objects" ] = qskObjectStatistics( m_counter, QskObjectCounter::Objects );
+    result[ "items" ] = qskObjectStatistics( m_counter, QskObjectCounter::Items );
+
+    return result;
+}
+
+void Runner::renderFrame()
+{
+    /*
+        Grabbing the window does polishing, synchronizing and
+        rendering synchronously - without depending on any timers
+        or vsync of a platform.
+     */
+    ( void ) m_window->grabWindow();
+}
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include <QskObjectCounter.h>
+
+#include <QElapsedTimer>
+#include <QJsonObject>
+
+class QskWindow;
+class Scenario;
+
+/*
+    Runs a scenario frame by frame and collects the timings of the
+    phases of each frame, the size of the scene graph and the number of
+    objects, that have been created.
+ */
+class Runner
+{
+  public:
+    Runner( QskWindow* );
+
+    void setFrames( int warmup, int measured );
+
+    QJsonObject run( Scenario* );
+
+  private:
+    void renderFrame();
+
+    QskWindow* m_window;
+
+    int m_warmupFrames = 10;
+    int m_frames = 100;
+
+    QskObjectCounter m_counter;
+
+    QElapsedTimer m_clock;
+
+    qint64 m_beforeSynchronizing = -1;
+    qint64 m_afterSynchronizing = -1;
+    qint64 m_beforeRendering = -1;
+    qint64 m_afterRendering = -1;
+};
+
+#endif
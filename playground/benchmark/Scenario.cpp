@@ -0,0 +1,474 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include "Scenario.h"
+
+#include <QskGridBox.h>
+#include <QskInputPanelBox.h>
+#include <QskProgressBar.h>
+#include <QskPushButton.h>
+#include <QskSetup.h>
+#include <QskSimpleListBox.h>
+#include <QskSkinManager.h>
+#include <QskSlider.h>
+#include <QskTextLabel.h>
+#include <QskWindow.h>
+
+#include <QDebug>
+#include <QGuiApplication>
+#include <QMouseEvent>
+#include <QQmlComponent>
+#include <QQmlEngine>
+
+namespace
+{
+    /*
+        A screen with a typical mix of controls
+     */
+    class Screen : public QskGridBox
+    {
+      public:
+        Screen( int rows = 12, int columns = 6 )
+        {
+            setMargins( 10 );
+            setSpacing( 5 );
+
+            for ( int row = 0; row < rows; row++ )
+            {
+                for ( int col = 0; col < columns; col++ )
+                    addItem( createControl( row, col ), row, col );
+            }
+        }
+
+      private:
+        QQuickItem* createControl( int row, int col ) const
+        {
+            const auto text = QStringLiteral( "Item %1/%2" ).arg( row ).arg( col );
+
+            switch( ( row + col ) % 4 )
+            {
+                case 0:
+                    return new QskPushButton( text );
+
+                case 1:
+                    return new QskTextLabel( text );
+
+                case 2:
+                {
+                    auto slider = new QskSlider();
+                    slider->setValueAsRatio( ( col + 1.0 ) / 8.0 );
+
+                    return slider;
+                }
+                default:
+                {
+                    auto progressBar = new QskProgressBar( 0.0, 100.0 );
+                    progressBar->setValue( 10.0 * row );
+
+                    return progressBar;
+                }
+            }
+        }
+    };
+
+    class OpenScenario final : public Scenario
+    {
+      public:
+        OpenScenario()
+            : Scenario( QStringLiteral( "open" ) )
+        {
+        }
+
+        void step( QskWindow* window, int ) override
+        {
+            // replacing the screen by a new one
+            delete m_screen;
+
+            m_screen = new Screen();
+            window->addItem( m_screen );
+        }
+
+        void cleanup( QskWindow* ) override
+        {
+            delete m_screen;
+            m_screen = nullptr;
+        }
+
+      private:
+        Screen* m_screen = nullptr;
+    };
+
+    class ResizeScenario final : public Scenario
+    {
+      public:
+        ResizeScenario()
+            : Scenario( QStringLiteral( "resize" ) )
+        {
+        }
+
+        void setup( QskWindow* window ) override
+        {
+            m_size = window->size();
+
+            m_screen = new Screen();
+            window->addItem( m_screen );
+        }
+
+        void step( QskWindow* window, int frame ) override
+        {
+            // shrinking and growing in steps of 2%
+            const int n = frame % 50;
+            const qreal f = 1.0 - 0.02 * ( n < 25 ? n : 50 - n );
+
+            window->resize( m_size * f );
+        }
+
+        void cleanup( QskWindow* window ) override
+        {
+            delete m_screen;
+            m_screen = nullptr;
+
+            window->resize( m_size );
+        }
+
+      private:
+        Screen* m_screen = nullptr;
+        QSize m_size;
+    };
+
+    class SkinScenario final : public Scenario
+    {
+      public:
+        SkinScenario()
+            : Scenario( QStringLiteral( "skin" ) )
+        {
+        }
+
+        void setup( QskWindow* window ) override
+        {
+            m_skinName = qskSetup->skinName();
+            m_skinNames = qskSkinManager->skinNames();
+
+            m_screen = new Screen();
+            window->addItem( m_screen );
+        }
+
+        void step( QskWindow*, int frame ) override
+        {
+            if ( !m_skinNames.isEmpty() )
+                qskSetup->setSkin( m_skinNames[ frame % m_skinNames.count() ] );
+        }
+
+        void cleanup( QskWindow* ) override
+        {
+            delete m_screen;
+            m_screen = nullptr;
+
+            qskSetup->setSkin( m_skinName );
+        }
+
+      private:
+        Screen* m_screen = nullptr;
+
+        QString m_skinName;
+        QStringList m_skinNames;
+    };
+
+    class ScrollScenario final : public Scenario
+    {
+      public:
+        ScrollScenario()
+            : Scenario( QStringLiteral( "scroll" ) )
+        {
+        }
+
+        void setup( QskWindow* window ) override
+        {
+            QStringList entries;
+            for ( int i = 0; i < 10000; i++ )
+                entries += QStringLiteral( "Row %1: The quick brown fox" ).arg( i + 1 );
+
+            m_listBox = new QskSimpleListBox();
+            m_listBox->setEntries( entries );
+
+            window->addItem( m_listBox );
+        }
+
+        void step( QskWindow*, int frame ) override
+        {
+            // scrolling by a bit more than a page
+            const qreal y = ( frame * 613 ) % 100000;
+            m_listBox->setScrollPos( QPointF( 0.0, y ) );
+        }
+
+        void cleanup( QskWindow* ) override
+        {
+            delete m_listBox;
+            m_listBox = nullptr;
+        }
+
+      private:
+        QskSimpleListBox* m_listBox = nullptr;
+    };
+
+    class HoverScenario final : public Scenario
+    {
+      public:
+        HoverScenario()
+            : Scenario( QStringLiteral( "hover" ) )
+        {
+        }
+
+        void setup( QskWindow* window ) override
+        {
+            m_screen = new Screen();
+            window->addItem( m_screen );
+        }
+
+        void step( QskWindow* window, int frame ) override
+        {
+            // moving the mouse over all cells of the screen - row by row
+
+            const auto r = m_screen->layoutRect();
+
+            const int rows = m_screen->rowCount();
+            const int columns = m_screen->columnCount();
+
+            const int cell = frame % ( rows * columns );
+
+            const QPointF pos = m_screen->mapToScene( QPointF(
+                r.left() + ( cell % columns + 0.5 ) * r.width() / columns,
+                r.top() + ( cell / columns + 0.5 ) * r.height() / rows ) );
+
+            QMouseEvent event( QEvent::MouseMove, pos,
+                Qt::NoButton, Qt::NoButton, Qt::NoModifier );
+
+            QCoreApplication::sendEvent( window, &event );
+        }
+
+        void cleanup( QskWindow* ) override
+        {
+            delete m_screen;
+            m_screen = nullptr;
+        }
+
+      private:
+        Screen* m_screen = nullptr;
+    };
+
+    /*
+        Showing/hiding an input panel in alternating frames: the
+        panel is created from scratch, like it is done by QskInputPanel,
+        so that the frames measure its latency. "inputpanel" uses
+        a QskVirtualKeyboard, "inputpanelsimple" a QskSimpleVirtualKeyboard.
+     */
+    class InputPanelScenario final : public Scenario
+    {
+      public:
+        InputPanelScenario( const QString& name, bool simpleKeyboard )
+            : Scenario( name )
+            , m_simpleKeyboard( simpleKeyboard )
+        {
+        }
+
+        void step( QskWindow* window, int frame ) override
+        {
+            if ( frame % 2 )
+            {
+                delete m_panel;
+                m_panel = nullptr;
+
+                return;
+            }
+
+            m_panel = new QskInputPanelBox();
+            m_panel->setPanelHint( QskInputPanelBox::SimpleKeyboard, m_simpleKeyboard );
+
+            window->addItem( m_panel );
+        }
+
+        void cleanup( QskWindow* ) override
+        {
+            delete m_panel;
+            m_panel = nullptr;
+        }
+
+      private:
+        const bool m_simpleKeyboard;
+        QskInputPanelBox* m_panel = nullptr;
+    };
+
+    /*
+        A screen of 1000 controls, created from QML, where all controls
+        have bindings depending on a counter, that is incremented
+        with each frame. "qml" binds to the scalar properties of the
+        control extension, while "qmlvariant" assigns the value types,
+        that have to be converted from JavaScript values.
+     */
+    const char qskTypedBindings[] =
+        R"(
+            import QtQuick 2.0
+            import Skinny 1.0 as Qsk
+
+            Qsk.LinearBox
+            {
+                property int counter: 0
+
+                dimension: 40
+                spacing: 1
+
+                Repeater
+                {
+                    model: 1000
+
+                    Qsk.Control
+                    {
+                        leftMargin: ( counter + index ) % 5
+                        rightMargin: ( counter + index ) % 3
+                        preferredWidth: 10 + ( counter + index ) % 10
+                        preferredHeight: 10
+                        backgroundColor: ( counter + index ) % 2 ? "steelblue" : "salmon"
+                    }
+                }
+            }
+        )";
+
+    const char qskVariantBindings[] =
+        R"(
+            import QtQuick 2.0
+            import Skinny 1.0 as Qsk
+
+            Qsk.LinearBox
+            {
+                property int counter: 0
+
+                dimension: 40
+                spacing: 1
+
+                Repeater
+                {
+                    model: 1000
+
+                    Qsk.Control
+                    {
+                        margins: ( { "left": ( counter + index ) % 5, "right": ( counter + index ) % 3 } )
+                        preferredSize: Qt.size( 10 + ( counter + index ) % 10, 10 )
+                        background: ( counter + index ) % 2 ? "steelblue" : "salmon"
+                    }
+                }
+            }
+        )";
+
+    class QmlScenario final : public Scenario
+    {
+      public:
+        QmlScenario( const QString& name, const char* source )
+            : Scenario( name )
+            , m_source( source )
+        {
+        }
+
+        void setup( QskWindow* window ) override
+        {
+            m_engine = new QQmlEngine();
+
+            QQmlComponent component( m_engine );
+            component.setData( m_source, QUrl() );
+
+            m_item = qobject_cast< QQuickItem* >( component.create() );
+            if ( m_item == nullptr )
+            {
+                qWarning() << component.errors();
+                return;
+            }
+
+            window->addItem( m_item );
+        }
+
+        void step( QskWindow*, int frame ) override
+        {
+            if ( m_item )
+                m_item->setProperty( "counter", frame );
+        }
+
+        void cleanup( QskWindow* ) override
+        {
+            delete m_item;
+            m_item = nullptr;
+
+            delete m_engine;
+            m_engine = nullptr;
+        }
+
+      private:
+        const QByteArray m_source;
+
+        QQmlEngine* m_engine = nullptr;
+        QQuickItem* m_item = nullptr;
+    };
+}
+
+Scenario::Scenario( const QString& name )
+    : m_name( name )
+{
+}
+
+Scenario::~Scenario()
+{
+}
+
+QString Scenario::name() const
+{
+    return m_name;
+}
+
+void Scenario::setup( QskWindow* )
+{
+}
+
+void Scenario::cleanup( QskWindow* )
+{
+}
+
+QStringList Scenario::names()
+{
+    return { QStringLiteral( "open" ), QStringLiteral( "resize" ),
+        QStringLiteral( "skin" ), QStringLiteral( "scroll" ),
+        QStringLiteral( "hover" ), QStringLiteral( "inputpanel" ),
+        QStringLiteral( "inputpanelsimple" ), QStringLiteral( "qml" ),
+        QStringLiteral( "qmlvariant" ) };
+}
+
+Scenario* Scenario::create( const QString& name )
+{
+    if ( name == QStringLiteral( "open" ) )
+        return new OpenScenario();
+
+    if ( name == QStringLiteral( "resize" ) )
+        return new ResizeScenario();
+
+    if ( name == QStringLiteral( "skin" ) )
+        return new SkinScenario();
+
+    if ( name == QStringLiteral( "scroll" ) )
+        return new ScrollScenario();
+
+    if ( name == QStringLiteral( "hover" ) )
+        return new HoverScenario();
+
+    if ( name == QStringLiteral( "inputpanel" ) )
+        return new InputPanelScenario( name, false );
+
+    if ( name == QStringLiteral( "inputpanelsimple" ) )
+        return new InputPanelScenario( name, true );
+
+    if ( name == QStringLiteral( "qml" ) )
+        return new QmlScenario( name, qskTypedBindings );
+
+    if ( name == QStringLiteral( "qmlvariant" ) )
+        return new QmlScenario( name, qskVariantBindings );
+
+    return nullptr;
+}
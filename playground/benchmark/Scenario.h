@@ -0,0 +1,37 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <QStringList>
+
+class QskWindow;
+
+/*
+    A scripted sequence of modifications, where each step
+    is followed by rendering a frame. The steps must not depend on
+    timers or any other external input to keep the results reproducible.
+ */
+class Scenario
+{
+  public:
+    Scenario( const QString& name );
+    virtual ~Scenario();
+
+    QString name() const;
+
+    virtual void setup( QskWindow* );
+    virtual void step( QskWindow*, int frame ) = 0;
+    virtual void cleanup( QskWindow* );
+
+    static QStringList names();
+    static Scenario* create( const QString& name );
+
+  private:
+    const QString m_name;
+};
+
+#endif
@@ -0,0 +1,13 @@
+CONFIG += qskexample
+CONFIG += qskqmlexport
+
+QT += quick_private qml
+
+HEADERS += \
+    Runner.h \
+    Scenario.h
+
+SOURCES += \
+    Runner.cpp \
+    Scenario.cpp \
+    main.cpp
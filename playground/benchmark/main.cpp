@@ -0,0 +1,129 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include "Runner.h"
+#include "Scenario.h"
+
+#include <SkinnyFont.h>
+
+#include <QskQml.h>
+#include <QskSetup.h>
+#include <QskWindow.h>
+
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSysInfo>
+
+#include <iostream>
+
+static void qskSetDefaultEnvironment( const char* name, const char* value )
+{
+    if ( !qEnvironmentVariableIsSet( name ) )
+        qputenv( name, value );
+}
+
+int main( int argc, char* argv[] )
+{
+    /*
+        No window system, no GPU: rendering is done by the software
+        backend into offscreen surfaces. The basic render loop
+        renders in the GUI thread, so that we can measure the phases.
+     */
+    qskSetDefaultEnvironment( "QT_QPA_PLATFORM", "offscreen" );
+    qskSetDefaultEnvironment( "QT_QUICK_BACKEND", "software" );
+    qskSetDefaultEnvironment( "QSG_RENDER_LOOP", "basic" );
+
+    QskQml::registerTypes();
+
+    QGuiApplication app( argc, argv );
+
+    // the same font on all systems
+    SkinnyFont::init( &app );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Headless benchmarks of QSkinny scenes" );
+    parser.addHelpOption();
+
+    parser.addOption( { "scenario",
+        "Scenario to run, can be repeated. Default: all of "
+            + Scenario::names().join( ", " ), "name" } );
+
+    parser.addOption( { "frames", "Measured frames per scenario.", "count", "100" } );
+    parser.addOption( { "warmup", "Frames, that are not measured.", "count", "10" } );
+    parser.addOption( { "size", "Size of the window.", "WxH", "800x600" } );
+    parser.addOption( { "skin", "Initial skin.", "name" } );
+    parser.addOption( { "output", "File for the JSON report. Default: stdout", "file" } );
+
+    parser.process( app );
+
+    auto names = parser.values( "scenario" );
+    if ( names.isEmpty() )
+        names = Scenario::names();
+
+    const auto sizeValues = parser.value( "size" ).split( 'x' );
+
+    QSize size( 800, 600 );
+    if ( sizeValues.count() == 2 )
+        size = QSize( sizeValues[ 0 ].toInt(), sizeValues[ 1 ].toInt() );
+
+    if ( parser.isSet( "skin" ) )
+        qskSetup->setSkin( parser.value( "skin" ) );
+
+    QskWindow window;
+    window.resize( size );
+    window.show();
+
+    Runner runner( &window );
+    runner.setFrames( parser.value( "warmup" ).toInt(),
+        parser.value( "frames" ).toInt() );
+
+    QJsonArray scenarios;
+
+    for ( const auto& name : qAsConst( names ) )
+    {
+        const auto scenario = Scenario::create( name );
+        if ( scenario == nullptr )
+        {
+            qWarning() << "Unknown scenario:" << name;
+            return 1;
+        }
+
+        scenarios += runner.run( scenario );
+        delete scenario;
+    }
+
+    QJsonObject report;
+    report[ "qskinny" ] = QSK_VERSION_STR;
+    report[ "qt" ] = qVersion();
+    report[ "platform" ] = QSysInfo::prettyProductName();
+    report[ "cpu" ] = QSysInfo::currentCpuArchitecture();
+    report[ "skin" ] = qskSetup->skinName();
+    report[ "size" ] = QJsonArray( { size.width(), size.height() } );
+    report[ "scenarios" ] = scenarios;
+
+    const auto json = QJsonDocument( report ).toJson();
+
+    if ( parser.isSet( "output" ) )
+    {
+        QFile file( parser.value( "output" ) );
+        if ( !file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+        {
+            qWarning() << "Can't write to:" << file.fileName();
+            return 1;
+        }
+
+        file.write( json );
+    }
+    else
+    {
+        std::cout << json.constData();
+    }
+
+    return 0;
+}
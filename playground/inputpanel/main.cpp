@@ -20,6 +20,7 @@
 
 #include <QskObjectCounter.h>
 
+#include <QDebug>
 #include <QFontMetricsF>
 #include <QGuiApplication>
 
@@ -293,6 +294,19 @@ int main( int argc, char* argv[] )
     qskDialog->setPolicy( QskDialog::EmbeddedBox );
 #endif
 
+    if ( auto context = QskInputContext::instance() )
+    {
+        if ( app.arguments().contains( QStringLiteral( "--preload" ) ) )
+        {
+            // panels for the most likely locales, created when being idle
+            context->preloadPanels( { QLocale( QLocale::English, QLocale::UnitedStates ),
+                QLocale( QLocale::German ), QLocale( QLocale::Chinese ) } );
+        }
+
+        QObject::connect( context, &QskInputContext::panelShown,
+            []( qreal latency ) { qDebug() << "Input panel shown after" << latency << "ms"; } );
+    }
+
     Window window1;
     window1.setObjectName( "Window 1" );
     window1.setColor( "PapayaWhip" );
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include <SkinnyShortcut.h>
+
+#include <QskItemView.h>
+#include <QskLinearBox.h>
+#include <QskObjectCounter.h>
+#include <QskTextLabel.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+
+/*
+    A view of many entries with texts of different lengths, so that
+    the heights of the rows vary. Only the delegates of the visible
+    rows exist, the others are estimated - the counters in the header
+    show, how many delegates are in use and how many are in the pool.
+ */
+class MessageView : public QskItemView
+{
+    Q_OBJECT
+
+    using Inherited = QskItemView;
+
+  public:
+    MessageView( int count, QQuickItem* parent = nullptr )
+        : QskItemView( parent )
+        , m_count( count )
+    {
+        setSpacing( 5 );
+        setEstimatedRowHeight( 50 );
+    }
+
+    int count() const override
+    {
+        return m_count;
+    }
+
+  Q_SIGNALS:
+    void layoutUpdated();
+
+  protected:
+    QskControl* createDelegate() override
+    {
+        auto label = new QskTextLabel();
+        label->setPanel( true );
+        label->setWrapMode( QskTextOptions::WordWrap );
+
+        return label;
+    }
+
+    void updateDelegate( QskControl* delegate, int index ) override
+    {
+        auto label = static_cast< QskTextLabel* >( delegate );
+        label->setText( message( index ) );
+    }
+
+    void updateLayout() override
+    {
+        Inherited::updateLayout();
+        Q_EMIT layoutUpdated();
+    }
+
+  private:
+    QString message( int index ) const
+    {
+        static const QString words = QStringLiteral(
+            "The quick brown fox jumps over the lazy dog. " );
+
+        // between 1 and 12 sentences
+        const int count = 1 + ( index * 7919 ) % 12;
+
+        return QStringLiteral( "#%1: " ).arg( index + 1 ) + words.repeated( count );
+    }
+
+    const int m_count;
+};
+
+int main( int argc, char* argv[] )
+{
+#ifdef ITEM_STATISTICS
+    QskObjectCounter counter( true );
+#endif
+
+    QGuiApplication app( argc, argv );
+
+    SkinnyShortcut::enable( SkinnyShortcut::AllShortcuts );
+
+    auto box = new QskLinearBox( Qt::Vertical );
+    box->setMargins( 10 );
+
+    auto header = new QskTextLabel( box );
+    header->setSizePolicy( Qt::Vertical, QskSizePolicy::Fixed );
+
+    auto view = new MessageView( 100000, box );
+
+    QObject::connect( view, &MessageView::layoutUpdated, header,
+        [ view, header ]
+        {
+            header->setText( QStringLiteral( "Entries: %1, Delegates: %2, Pooled: %3" )
+                .arg( view->count() )
+                .arg( view->activeDelegateCount() )
+                .arg( view->pooledDelegateCount() ) );
+        } );
+
+    QskWindow window;
+    window.addItem( box );
+    window.resize( 600, 800 );
+    window.show();
+
+    return app.exec();
+}
+
+#include "main.moc"
@@ -2,10 +2,13 @@ TEMPLATE = subdirs
 
 SUBDIRS += \
     anchors \
+    benchmark \
     dialogbuttons \
     invoker \
     inputpanel \
-    images
+    images \
+    itemview \
+    tiles
 
 qtHaveModule(webengine) {
 
@@ -1,10 +1,11 @@
 #include "ShadowedBox.h"
-#include "BoxShadowNode.h"
 
 #include <QskBoxNode.h>
 #include <QskBoxBorderMetrics.h>
 #include <QskBoxBorderColors.h>
 #include <QskGradient.h>
+#include <QskShadowMetrics.h>
+#include <QskShadowNode.h>
 #include <QskSkinlet.h>
 
 namespace
@@ -39,22 +40,18 @@ namespace
             {
                 case ShadowRole:
                 {
-                    auto shadowNode = static_cast< BoxShadowNode* >( node );
+                    auto shadowNode = static_cast< QskShadowNode* >( node );
                     if ( shadowNode == nullptr )
-                        shadowNode = new BoxShadowNode();
+                        shadowNode = new QskShadowNode();
 
                     const auto& s = box->shadow();
-                    const qreal dx = s.extent + s.xOffset;
-                    const qreal dy = s.extent + s.yOffset;
 
-                    auto r = box->subControlRect( ShadowedBox::Panel );
-                    r.adjust( -dx, -dy, dx, dy );
+                    const QskShadowMetrics metrics( 0.0, s.extent,
+                        QPointF( s.xOffset, s.yOffset ) );
 
-                    shadowNode->setRect( r );
-                    shadowNode->setShape( box->shape() );
-                    shadowNode->setShadow( s.extent, s.xOffset, s.yOffset );
-                    shadowNode->setColor( box->shadowColor() );
-                    shadowNode->updateGeometry();
+                    shadowNode->setShadowData( box->window(),
+                        box->subControlRect( ShadowedBox::Panel ),
+                        box->shape(), metrics, box->shadowColor() );
 
                     return shadowNode;
                 }
@@ -1,14 +1,8 @@
 CONFIG += qskexample
-QT += quick_private
-
-RESOURCES += \
-    shaders.qrc
 
 HEADERS += \
-    ShadowedBox.h \
-    BoxShadowNode.h
+    ShadowedBox.h
 
 SOURCES += \
     ShadowedBox.cpp \
-    BoxShadowNode.cpp \
     main.cpp
@@ -0,0 +1,181 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include "ZoomableGraphic.h"
+
+#include <QskColorFilter.h>
+#include <QskEvent.h>
+#include <QskSkinlet.h>
+#include <QskTiledGraphicNode.h>
+
+#include <QMouseEvent>
+#include <QWheelEvent>
+#include <QtMath>
+
+namespace
+{
+    class Skinlet : public QskSkinlet
+    {
+      public:
+        enum NodeRole { GraphicRole };
+
+        Skinlet()
+        {
+            setNodeRoles( { GraphicRole } );
+        }
+
+        QRectF subControlRect( const QskSkinnable*,
+            const QRectF& contentsRect, QskAspect::Subcontrol subControl ) const override
+        {
+            if ( subControl == ZoomableGraphic::Panel )
+                return contentsRect;
+
+            return QRectF();
+        }
+
+        QSGNode* updateSubNode( const QskSkinnable* skinnable,
+            quint8 nodeRole, QSGNode* node ) const override
+        {
+            const auto view = static_cast< const ZoomableGraphic* >( skinnable );
+
+            if ( nodeRole == GraphicRole )
+            {
+                auto graphicNode = static_cast< QskTiledGraphicNode* >( node );
+                if ( graphicNode == nullptr )
+                    graphicNode = new QskTiledGraphicNode();
+
+                const bool isComplete = graphicNode->setGraphic(
+                    view->window(), view->graphic(), QskColorFilter(),
+                    QskTextureRenderer::Raster, view->graphicRect(),
+                    view->subControlRect( ZoomableGraphic::Panel ) );
+
+                if ( !isComplete )
+                {
+                    /*
+                        The remaining tiles will be rasterized in the
+                        following frames, while the preview is shown
+                     */
+                    QMetaObject::invokeMethod( const_cast< ZoomableGraphic* >( view ),
+                        "update", Qt::QueuedConnection );
+                }
+
+                return graphicNode;
+            }
+
+            return nullptr;
+        }
+    };
+}
+
+QSK_SUBCONTROL( ZoomableGraphic, Panel )
+
+ZoomableGraphic::ZoomableGraphic( QQuickItem* parentItem )
+    : QskControl( parentItem )
+{
+    setFlag( QQuickItem::ItemHasContents, true );
+    setClip( true );
+
+    setAcceptedMouseButtons( Qt::LeftButton );
+    setWheelEnabled( true );
+
+    setSkinlet( new Skinlet() );
+}
+
+ZoomableGraphic::~ZoomableGraphic()
+{
+}
+
+void ZoomableGraphic::setGraphic( const QskGraphic& graphic )
+{
+    m_graphic = graphic;
+
+    m_zoom = 1.0;
+    m_offset = QPointF();
+
+    update();
+}
+
+const QskGraphic& ZoomableGraphic::graphic() const
+{
+    return m_graphic;
+}
+
+void ZoomableGraphic::setZoom( qreal zoom, const QPointF& center )
+{
+    zoom = qBound( 1.0, zoom, 256.0 );
+    if ( qFuzzyCompare( zoom, m_zoom ) )
+        return;
+
+    // the point of the graphic at center stays in place
+
+    const auto oldRect = graphicRect();
+    if ( oldRect.isEmpty() )
+    {
+        m_zoom = zoom;
+        return;
+    }
+
+    const qreal px = ( center.x() - oldRect.left() ) / oldRect.width();
+    const qreal py = ( center.y() - oldRect.top() ) / oldRect.height();
+
+    m_zoom = zoom;
+    m_offset = QPointF();
+
+    const auto rect = graphicRect();
+
+    m_offset = QPointF( center.x() - px * rect.width() - rect.left(),
+        center.y() - py * rect.height() - rect.top() );
+
+    update();
+}
+
+qreal ZoomableGraphic::zoom() const
+{
+    return m_zoom;
+}
+
+QRectF ZoomableGraphic::graphicRect() const
+{
+    const auto r = contentsRect();
+
+    auto size = m_graphic.defaultSize();
+    if ( size.isEmpty() || r.isEmpty() )
+        return QRectF();
+
+    size.scale( r.size(), Qt::KeepAspectRatio );
+    size *= m_zoom;
+
+    const QPointF pos( r.left() + 0.5 * ( r.width() - size.width() / m_zoom ),
+        r.top() + 0.5 * ( r.height() - size.height() / m_zoom ) );
+
+    return QRectF( pos + m_offset, size );
+}
+
+void ZoomableGraphic::wheelEvent( QWheelEvent* event )
+{
+    const auto steps = event->angleDelta().y() / 120.0;
+    setZoom( m_zoom * qPow( 1.25, steps ), qskWheelPosition( event ) );
+}
+
+void ZoomableGraphic::mousePressEvent( QMouseEvent* event )
+{
+    m_pressedPos = qskMousePosition( event );
+}
+
+void ZoomableGraphic::mouseMoveEvent( QMouseEvent* event )
+{
+    const auto pos = qskMousePosition( event );
+
+    m_offset += pos - m_pressedPos;
+    m_pressedPos = pos;
+
+    update();
+}
+
+void ZoomableGraphic::mouseReleaseEvent( QMouseEvent* )
+{
+}
+
+#include "moc_ZoomableGraphic.cpp"
@@ -0,0 +1,52 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#ifndef ZOOMABLE_GRAPHIC_H
+#define ZOOMABLE_GRAPHIC_H
+
+#include <QskControl.h>
+#include <QskGraphic.h>
+
+/*
+    A graphic, that can be zoomed with the mouse wheel and
+    panned by dragging. It is displayed by a QskTiledGraphicNode,
+    so only the visible tiles are rasterized - a few of them per frame.
+ */
+class ZoomableGraphic : public QskControl
+{
+    Q_OBJECT
+
+  public:
+    QSK_SUBCONTROLS( Panel )
+
+    ZoomableGraphic( QQuickItem* parent = nullptr );
+    ~ZoomableGraphic() override;
+
+    void setGraphic( const QskGraphic& );
+    const QskGraphic& graphic() const;
+
+    void setZoom( qreal zoom, const QPointF& center );
+    qreal zoom() const;
+
+    // the geometry of the zoomed graphic in item coordinates
+    QRectF graphicRect() const;
+
+  protected:
+    void wheelEvent( QWheelEvent* ) override;
+
+    void mousePressEvent( QMouseEvent* ) override;
+    void mouseMoveEvent( QMouseEvent* ) override;
+    void mouseReleaseEvent( QMouseEvent* ) override;
+
+  private:
+    QskGraphic m_graphic;
+
+    qreal m_zoom = 1.0;
+    QPointF m_offset;
+
+    QPointF m_pressedPos;
+};
+
+#endif
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the 3-clause BSD License
+ *****************************************************************************/
+
+#include "ZoomableGraphic.h"
+
+#include <SkinnyShapeFactory.h>
+#include <SkinnyShortcut.h>
+
+#include <QskGraphic.h>
+#include <QskObjectCounter.h>
+#include <QskRgbValue.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+#include <QPainter>
+
+#include <cstdlib>
+
+/*
+    A graphic with a lot of details, that become visible
+    only when zooming in - like a map or a technical drawing.
+ */
+static QskGraphic mapGraphic( int dim )
+{
+    const qreal cellSize = 10.0;
+
+    QskGraphic graphic;
+
+    QPainter painter( &graphic );
+    painter.setRenderHint( QPainter::Antialiasing, true );
+
+    QPen pen( Qt::black, 0.2 );
+    pen.setJoinStyle( Qt::MiterJoin );
+    painter.setPen( pen );
+
+    for ( int row = 0; row < dim; row++ )
+    {
+        for ( int col = 0; col < dim; col++ )
+        {
+            const auto shape = static_cast< SkinnyShapeFactory::Shape >(
+                std::rand() % SkinnyShapeFactory::ShapeCount );
+
+            const auto path = SkinnyShapeFactory::shapePath(
+                shape, QSizeF( 0.8 * cellSize, 0.8 * cellSize ) );
+
+            painter.setBrush( QColor::fromHsv( ( row + col ) % 360, 160, 220 ) );
+            painter.drawPath( path.translated( ( col + 0.1 ) * cellSize,
+                ( row + 0.1 ) * cellSize ) );
+        }
+    }
+
+    painter.end();
+
+    return graphic;
+}
+
+int main( int argc, char* argv[] )
+{
+#ifdef ITEM_STATISTICS
+    QskObjectCounter counter( true );
+#endif
+
+    QGuiApplication app( argc, argv );
+
+    SkinnyShortcut::enable( SkinnyShortcut::AllShortcuts );
+
+    auto view = new ZoomableGraphic();
+    view->setMargins( 10 );
+    view->setGraphic( mapGraphic( 100 ) );
+
+    QskWindow window;
+    window.setColor( QskRgb::WhiteSmoke );
+    window.addItem( view );
+    window.resize( 800, 800 );
+    window.show();
+
+    return app.exec();
+}
@@ -0,0 +1,8 @@
+CONFIG += qskexample
+
+HEADERS += \
+    ZoomableGraphic.h
+
+SOURCES += \
+    ZoomableGraphic.cpp \
+    main.cpp
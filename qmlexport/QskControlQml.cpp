@@ -0,0 +1,148 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskControlQml.h"
+
+#include <QskControl.h>
+#include <QskGradient.h>
+#include <QskMargins.h>
+
+QskControlQml::QskControlQml( QObject* control )
+    : Inherited( control )
+    , m_control( qobject_cast< QskControl* >( control ) )
+{
+    Q_ASSERT( m_control );
+
+    connect( m_control, &QskControl::marginsChanged,
+        this, &QskControlQml::marginsChanged );
+
+    connect( m_control, &QskControl::backgroundChanged,
+        this, &QskControlQml::backgroundChanged );
+}
+
+QskControlQml::~QskControlQml()
+{
+}
+
+void QskControlQml::setMarginAt( Qt::Edge edge, qreal margin )
+{
+    QskMargins margins = m_control->margins();
+    margins.setMarginsAt( edge, margin );
+
+    m_control->setMargins( margins );
+}
+
+void QskControlQml::setLeftMargin( qreal margin )
+{
+    setMarginAt( Qt::LeftEdge, margin );
+}
+
+qreal QskControlQml::leftMargin() const
+{
+    return m_control->margins().left();
+}
+
+void QskControlQml::setTopMargin( qreal margin )
+{
+    setMarginAt( Qt::TopEdge, margin );
+}
+
+qreal QskControlQml::topMargin() const
+{
+    return m_control->margins().top();
+}
+
+void QskControlQml::setRightMargin( qreal margin )
+{
+    setMarginAt( Qt::RightEdge, margin );
+}
+
+qreal QskControlQml::rightMargin() const
+{
+    return m_control->margins().right();
+}
+
+void QskControlQml::setBottomMargin( qreal margin )
+{
+    setMarginAt( Qt::BottomEdge, margin );
+}
+
+qreal QskControlQml::bottomMargin() const
+{
+    return m_control->margins().bottom();
+}
+
+void QskControlQml::setBackgroundColor( const QColor& color )
+{
+    m_control->setBackgroundColor( color );
+}
+
+QColor QskControlQml::backgroundColor() const
+{
+    // for gradients the first color
+    return m_control->background().startColor();
+}
+
+void QskControlQml::setMinimumWidth( qreal width )
+{
+    m_control->setMinimumWidth( width );
+}
+
+qreal QskControlQml::minimumWidth() const
+{
+    return m_control->minimumSize().width();
+}
+
+void QskControlQml::setMinimumHeight( qreal height )
+{
+    m_control->setMinimumHeight( height );
+}
+
+qreal QskControlQml::minimumHeight() const
+{
+    return m_control->minimumSize().height();
+}
+
+void QskControlQml::setPreferredWidth( qreal width )
+{
+    m_control->setPreferredWidth( width );
+}
+
+qreal QskControlQml::preferredWidth() const
+{
+    return m_control->preferredSize().width();
+}
+
+void QskControlQml::setPreferredHeight( qreal height )
+{
+    m_control->setPreferredHeight( height );
+}
+
+qreal QskControlQml::preferredHeight() const
+{
+    return m_control->preferredSize().height();
+}
+
+void QskControlQml::setMaximumWidth( qreal width )
+{
+    m_control->setMaximumWidth( width );
+}
+
+qreal QskControlQml::maximumWidth() const
+{
+    return m_control->maximumSize().width();
+}
+
+void QskControlQml::setMaximumHeight( qreal height )
+{
+    m_control->setMaximumHeight( height );
+}
+
+qreal QskControlQml::maximumHeight() const
+{
+    return m_control->maximumSize().height();
+}
+
+#include "moc_QskControlQml.cpp"
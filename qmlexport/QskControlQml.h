@@ -0,0 +1,103 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_CONTROL_QML_H
+#define QSK_CONTROL_QML_H
+
+#include "QskQmlGlobal.h"
+
+#include <qcolor.h>
+#include <qobject.h>
+
+class QskControl;
+
+/*
+    Bindings to composite values like margins or background are passed
+    as QVariant and modified through the value type wrappers of the
+    QML engine. QskControlQml extends QskControl by scalar properties
+    for the parts, that are bound most often. Those are exchanged
+    as plain qreal/QColor values:
+
+        - "leftMargin: 5" instead of "margins.left: 5"
+        - "backgroundColor: "red"" instead of "background: "red""
+ */
+class QskControlQml : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( qreal leftMargin READ leftMargin
+        WRITE setLeftMargin NOTIFY marginsChanged FINAL )
+
+    Q_PROPERTY( qreal topMargin READ topMargin
+        WRITE setTopMargin NOTIFY marginsChanged FINAL )
+
+    Q_PROPERTY( qreal rightMargin READ rightMargin
+        WRITE setRightMargin NOTIFY marginsChanged FINAL )
+
+    Q_PROPERTY( qreal bottomMargin READ bottomMargin
+        WRITE setBottomMargin NOTIFY marginsChanged FINAL )
+
+    Q_PROPERTY( QColor backgroundColor READ backgroundColor
+        WRITE setBackgroundColor NOTIFY backgroundChanged FINAL )
+
+    Q_PROPERTY( qreal minimumWidth READ minimumWidth WRITE setMinimumWidth FINAL )
+    Q_PROPERTY( qreal minimumHeight READ minimumHeight WRITE setMinimumHeight FINAL )
+
+    Q_PROPERTY( qreal preferredWidth READ preferredWidth WRITE setPreferredWidth FINAL )
+    Q_PROPERTY( qreal preferredHeight READ preferredHeight WRITE setPreferredHeight FINAL )
+
+    Q_PROPERTY( qreal maximumWidth READ maximumWidth WRITE setMaximumWidth FINAL )
+    Q_PROPERTY( qreal maximumHeight READ maximumHeight WRITE setMaximumHeight FINAL )
+
+    using Inherited = QObject;
+
+  public:
+    QskControlQml( QObject* control );
+    ~QskControlQml() override;
+
+    void setLeftMargin( qreal );
+    qreal leftMargin() const;
+
+    void setTopMargin( qreal );
+    qreal topMargin() const;
+
+    void setRightMargin( qreal );
+    qreal rightMargin() const;
+
+    void setBottomMargin( qreal );
+    qreal bottomMargin() const;
+
+    void setBackgroundColor( const QColor& );
+    QColor backgroundColor() const;
+
+    void setMinimumWidth( qreal );
+    qreal minimumWidth() const;
+
+    void setMinimumHeight( qreal );
+    qreal minimumHeight() const;
+
+    void setPreferredWidth( qreal );
+    qreal preferredWidth() const;
+
+    void setPreferredHeight( qreal );
+    qreal preferredHeight() const;
+
+    void setMaximumWidth( qreal );
+    qreal maximumWidth() const;
+
+    void setMaximumHeight( qreal );
+    qreal maximumHeight() const;
+
+  Q_SIGNALS:
+    void marginsChanged();
+    void backgroundChanged();
+
+  private:
+    void setMarginAt( Qt::Edge, qreal );
+
+    QskControl* const m_control;
+};
+
+#endif
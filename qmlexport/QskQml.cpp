@@ -4,11 +4,13 @@
  *****************************************************************************/
 
 #include "QskQml.h"
+#include "QskControlQml.h"
 #include "QskLayoutQml.h"
 #include "QskShortcutQml.h"
 #include "QskMainQml.h"
 #include "QskRgbValueQml.h"
 
+#include <QskBoxShapeMetrics.h>
 #include <QskCorner.h>
 #include <QskDialog.h>
 #include <QskDialogButton.h>
@@ -58,6 +60,9 @@ QSK_QT_PRIVATE_END
 #define QSK_REGISTER( className, typeName ) \
     qmlRegisterType< className >( QSK_MODULE_NAME, 1, 0, typeName );
 
+#define QSK_REGISTER_EXTENDED( className, extensionName, typeName ) \
+    qmlRegisterExtendedType< className, extensionName >( QSK_MODULE_NAME, 1, 0, typeName );
+
 #define QSK_REGISTER_GADGET( className, typeName ) \
     qRegisterMetaType< className >(); \
     qmlRegisterUncreatableType< className >( QSK_MODULE_NAME, 1, 0, typeName, QString() )
@@ -118,6 +123,65 @@ static inline QskGradientStop qskToGradientStop( const QJSValue& value )
     );
 }
 
+static inline qreal qskToNumber( const QJSValue& value, const char* name, qreal defaultValue )
+{
+    const auto property = value.property( QLatin1String( name ) );
+    return property.isNumber() ? property.toNumber() : defaultValue;
+}
+
+static QskMargins qskToMargins( const QJSValue& value )
+{
+    if ( value.isNumber() )
+        return QskMargins( value.toNumber() );
+
+    if ( value.isArray() )
+    {
+        // [ left, top, right, bottom ]
+        return QskMargins( value.property( 0 ).toNumber(), value.property( 1 ).toNumber(),
+            value.property( 2 ).toNumber(), value.property( 3 ).toNumber() );
+    }
+
+    // { left: ..., top: ..., right: ..., bottom: ... }
+    return QskMargins(
+        qskToNumber( value, "left", 0.0 ), qskToNumber( value, "top", 0.0 ),
+        qskToNumber( value, "right", 0.0 ), qskToNumber( value, "bottom", 0.0 ) );
+}
+
+static QskBoxShapeMetrics qskToBoxShapeMetrics( const QJSValue& value )
+{
+    if ( value.isNumber() )
+        return QskBoxShapeMetrics( value.toNumber() );
+
+    // { radius: ..., topLeft: ..., ..., sizeMode: ... }
+
+    QskBoxShapeMetrics shape( qskToNumber( value, "radius", 0.0 ) );
+
+    const struct
+    {
+        const char* name;
+        Qt::Corner corner;
+    } corners[] =
+    {
+        { "topLeft", Qt::TopLeftCorner },
+        { "topRight", Qt::TopRightCorner },
+        { "bottomLeft", Qt::BottomLeftCorner },
+        { "bottomRight", Qt::BottomRightCorner }
+    };
+
+    for ( const auto& corner : corners )
+    {
+        const auto radius = value.property( QLatin1String( corner.name ) );
+        if ( radius.isNumber() )
+            shape.setRadius( corner.corner, radius.toNumber() );
+    }
+
+    const auto sizeMode = value.property( QLatin1String( "sizeMode" ) );
+    if ( sizeMode.isNumber() )
+        shape.setSizeMode( static_cast< Qt::SizeMode >( sizeMode.toInt() ) );
+
+    return shape;
+}
+
 void QskQml::registerTypes()
 {
 #if 0
@@ -142,7 +206,11 @@ void QskQml::registerTypes()
     QSK_REGISTER( QskGridBoxQml, "GridBox" );
     QSK_REGISTER( QskLinearBoxQml, "LinearBox" );
 
-    QSK_REGISTER( QskControl, "Control" );
+    /*
+        The extension is also available for all registered
+        types derived from QskControl
+     */
+    QSK_REGISTER_EXTENDED( QskControl, QskControlQml, "Control" );
     QSK_REGISTER( QskGraphicLabel, "GraphicLabel" );
     QSK_REGISTER( QskVirtualKeyboard, "VirtualKeyboard" );
     QSK_REGISTER( QskTextLabel, "TextLabel" );
@@ -193,6 +261,7 @@ void QskQml::registerTypes()
 
         QSK_REGISTER_GADGET( QskRgbValueQml, "RgbValue" );
         QSK_REGISTER_GADGET( QskStandardSymbol, "StandardSymbol" );
+        QSK_REGISTER_GADGET( QskBoxShapeMetrics, "BoxShapeMetrics" );
         QSK_REGISTER_GADGET( QskCorner, "Corner" );
         QSK_REGISTER_GADGET( QskGradient, "Gradient" );
         QSK_REGISTER_GADGET( QskGradientStop, "GradientStop" );
@@ -225,6 +294,17 @@ void QskQml::registerTypes()
     QQmlMetaType::registerCustomStringConverter( qMetaTypeId< QskMargins >(),
         []( const QString& s ) { return QVariant::fromValue( QskMargins( s.toDouble() ) ); } );
 
+    /*
+        Converting object literals directly, instead of going
+        through the generic QVariantMap conversions of the engine
+     */
+    QMetaType::registerConverter< QJSValue, QskMargins >( qskToMargins );
+    QMetaType::registerConverter< QJSValue, QskBoxShapeMetrics >( qskToBoxShapeMetrics );
+
+    // "background: "red"": monochrome gradients from color names
+    QQmlMetaType::registerCustomStringConverter( qMetaTypeId< QskGradient >(),
+        []( const QString& s ) { return QVariant::fromValue( QskGradient( QColor( s ) ) ); } );
+
     // Support QskSizePolicy in QML user properties
     QMetaType::registerConverter< QJSValue, QskSizePolicy >(
         []( const QJSValue& value )
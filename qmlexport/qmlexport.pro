@@ -8,6 +8,7 @@ contains(QSK_CONFIG, QskDll): DEFINES += QSK_QML_MAKEDLL
 
 HEADERS += \
     QskQmlGlobal.h \
+    QskControlQml.h \
     QskShortcutQml.h \
     QskLayoutQml.h \
     QskRgbValueQml.h \
@@ -15,6 +16,7 @@ HEADERS += \
     QskQml.h
 
 SOURCES += \
+    QskControlQml.cpp \
     QskShortcutQml.cpp \
     QskLayoutQml.cpp \
     QskMainQml.cpp \
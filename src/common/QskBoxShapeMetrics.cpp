@@ -161,3 +161,5 @@ QDebug operator<<( QDebug debug, const QskBoxShapeMetrics& metrics )
 }
 
 #endif
+
+#include "moc_QskBoxShapeMetrics.cpp"
@@ -16,6 +16,17 @@ class QVariant;
 
 class QSK_EXPORT QskBoxShapeMetrics
 {
+    Q_GADGET
+
+    Q_PROPERTY( QSizeF topLeft READ topLeft WRITE setTopLeft )
+    Q_PROPERTY( QSizeF topRight READ topRight WRITE setTopRight )
+    Q_PROPERTY( QSizeF bottomLeft READ bottomLeft WRITE setBottomLeft )
+    Q_PROPERTY( QSizeF bottomRight READ bottomRight WRITE setBottomRight )
+
+    Q_PROPERTY( Qt::SizeMode sizeMode READ sizeMode WRITE setSizeMode )
+    Q_PROPERTY( Qt::AspectRatioMode aspectRatioMode
+        READ aspectRatioMode WRITE setAspectRatioMode )
+
   public:
     constexpr QskBoxShapeMetrics() noexcept;
 
@@ -54,6 +65,18 @@ class QSK_EXPORT QskBoxShapeMetrics
 
     constexpr QSizeF radius( Qt::Corner ) const noexcept;
 
+    void setTopLeft( const QSizeF& ) noexcept;
+    constexpr QSizeF topLeft() const noexcept;
+
+    void setTopRight( const QSizeF& ) noexcept;
+    constexpr QSizeF topRight() const noexcept;
+
+    void setBottomLeft( const QSizeF& ) noexcept;
+    constexpr QSizeF bottomLeft() const noexcept;
+
+    void setBottomRight( const QSizeF& ) noexcept;
+    constexpr QSizeF bottomRight() const noexcept;
+
     constexpr bool isRectangle() const noexcept;
     constexpr bool isRectellipse() const noexcept;
 
@@ -193,6 +216,46 @@ inline constexpr QSizeF QskBoxShapeMetrics::radius( Qt::Corner corner ) const no
     return ( ( corner >= 0 ) && ( corner < 4 ) ) ? m_radii[ corner ] : QSizeF();
 }
 
+inline void QskBoxShapeMetrics::setTopLeft( const QSizeF& radius ) noexcept
+{
+    setRadius( Qt::TopLeftCorner, radius );
+}
+
+inline constexpr QSizeF QskBoxShapeMetrics::topLeft() const noexcept
+{
+    return m_radii[ Qt::TopLeftCorner ];
+}
+
+inline void QskBoxShapeMetrics::setTopRight( const QSizeF& radius ) noexcept
+{
+    setRadius( Qt::TopRightCorner, radius );
+}
+
+inline constexpr QSizeF QskBoxShapeMetrics::topRight() const noexcept
+{
+    return m_radii[ Qt::TopRightCorner ];
+}
+
+inline void QskBoxShapeMetrics::setBottomLeft( const QSizeF& radius ) noexcept
+{
+    setRadius( Qt::BottomLeftCorner, radius );
+}
+
+inline constexpr QSizeF QskBoxShapeMetrics::bottomLeft() const noexcept
+{
+    return m_radii[ Qt::BottomLeftCorner ];
+}
+
+inline void QskBoxShapeMetrics::setBottomRight( const QSizeF& radius ) noexcept
+{
+    setRadius( Qt::BottomRightCorner, radius );
+}
+
+inline constexpr QSizeF QskBoxShapeMetrics::bottomRight() const noexcept
+{
+    return m_radii[ Qt::BottomRightCorner ];
+}
+
 inline void QskBoxShapeMetrics::setSizeMode( Qt::SizeMode sizeMode ) noexcept
 {
     m_sizeMode = sizeMode;
@@ -28,20 +28,20 @@ static inline QskGradient::Orientation qskOrientation( Qt::Orientation o )
         ? QskGradient::Vertical : QskGradient::Horizontal;
 }
 
-static inline bool qskIsGradientValid( const QVector< QskGradientStop >& stops )
+static inline bool qskIsGradientValid( const QskGradientStop* stops, int count )
 {
-    if ( stops.size() < 2 )
+    if ( count < 2 )
         return false;
 
-    if ( stops.first().position() != 0.0 || stops.last().position() != 1.0 )
+    if ( stops[ 0 ].position() != 0.0 || stops[ count - 1 ].position() != 1.0 )
     {
         return false;
     }
 
-    if ( !stops.first().color().isValid() )
+    if ( !stops[ 0 ].color().isValid() )
         return false;
 
-    for ( int i = 1; i < stops.size(); i++ )
+    for ( int i = 1; i < count; i++ )
     {
         if ( stops[ i ].position() < stops[ i - 1 ].position() )
             return false;
@@ -53,9 +53,9 @@ static inline bool qskIsGradientValid( const QVector< QskGradientStop >& stops )
     return true;
 }
 
-static inline bool qskIsMonochrome( const QVector< QskGradientStop >& stops )
+static inline bool qskIsMonochrome( const QskGradientStop* stops, int count )
 {
-    for ( int i = 1; i < stops.size(); i++ )
+    for ( int i = 1; i < count; i++ )
     {
         if ( stops[ i ].color() != stops[ 0 ].color() )
             return false;
@@ -75,13 +75,13 @@ static inline QColor qskInterpolated(
 }
 
 static inline bool qskComparePositions(
-    const QVector< QskGradientStop >& s1, const QVector< QskGradientStop >& s2 )
+    const QskGradientStop* s1, int count1, const QskGradientStop* s2, int count2 )
 {
-    if ( s1.count() != s2.count() )
+    if ( count1 != count2 )
         return false;
 
     // the first is always at 0.0, the last at 1.0
-    for ( int i = 1; i < s1.count() - 1; i++ )
+    for ( int i = 1; i < count1 - 1; i++ )
     {
         if ( s1[ i ].position() != s2[ i ].position() )
             return false;
@@ -95,7 +95,7 @@ static inline QVector< QskGradientStop > qskExpandedStops(
 {
     // expand s1 by stops matching to the positions from s2
 
-    if ( qskComparePositions( s1, s2 ) )
+    if ( qskComparePositions( s1.constData(), s1.count(), s2.constData(), s2.count() ) )
         return s1;
 
     QVector< QskGradientStop > stops;
@@ -122,14 +122,14 @@ static inline QVector< QskGradientStop > qskExpandedStops(
 }
 
 static inline QVector< QskGradientStop > qskExtractedStops(
-    const QVector< QskGradientStop >& stops, qreal from, qreal to )
+    const QskGradientStop* stops, int count, qreal from, qreal to )
 {
     QVector< QskGradientStop > extracted;
 
     if ( from == to )
         extracted.reserve( 2 );
     else
-        extracted.reserve( stops.size() );
+        extracted.reserve( count );
 
     int i = 0;
 
@@ -139,7 +139,7 @@ static inline QVector< QskGradientStop > qskExtractedStops(
     }
     else
     {
-        for ( i = 1; i < stops.count(); i++ )
+        for ( i = 1; i < count; i++ )
         {
             if ( stops[i].position() > from )
                 break;
@@ -151,7 +151,7 @@ static inline QVector< QskGradientStop > qskExtractedStops(
         extracted += QskGradientStop( 0.0, color );
     }
 
-    for ( ; i < stops.count(); i++ )
+    for ( ; i < count; i++ )
     {
         const auto& s = stops[i];
 
@@ -255,39 +255,132 @@ QskGradient::QskGradient( Qt::Orientation orientation,
 QskGradient::QskGradient( Orientation orientation,
         const QVector< QskGradientStop >& stops )
     : m_orientation( orientation )
-    , m_stops( stops )
 {
+    assignStops( stops );
 }
 
 QskGradient::~QskGradient()
 {
 }
 
+bool QskGradient::operator==( const QskGradient& other ) const
+{
+    if ( ( m_orientation != other.m_orientation )
+        || ( m_stopCount != other.m_stopCount ) )
+    {
+        return false;
+    }
+
+    const auto hash1 = m_hash.loadAcquire();
+    const auto hash2 = other.m_hash.loadAcquire();
+
+    if ( hash1 != 0 && hash2 != 0 && hash1 != hash2 )
+        return false;
+
+    const auto stops1 = stopData();
+    const auto stops2 = other.stopData();
+
+    if ( stops1 == stops2 )
+        return true; // sharing the same vector
+
+    for ( int i = 0; i < m_stopCount; i++ )
+    {
+        if ( stops1[ i ] != stops2[ i ] )
+            return false;
+    }
+
+    return true;
+}
+
+void QskGradient::assignStops( const QVector< QskGradientStop >& stops )
+{
+    m_stopCount = stops.count();
+
+    if ( m_stopCount > 2 )
+    {
+        m_stops = stops;
+    }
+    else
+    {
+        m_stops.clear();
+
+        for ( int i = 0; i < 2; i++ )
+            m_inlineStops[ i ] = ( i < m_stopCount ) ? stops[ i ] : QskGradientStop();
+    }
+
+    m_hash.storeRelease( 0 );
+}
+
+void QskGradient::resizeStops( int count )
+{
+    if ( count == m_stopCount )
+        return;
+
+    if ( count > 2 )
+    {
+        if ( m_stopCount <= 2 )
+        {
+            m_stops.reserve( count );
+
+            for ( int i = 0; i < m_stopCount; i++ )
+                m_stops += m_inlineStops[ i ];
+        }
+
+        m_stops.resize( count );
+    }
+    else
+    {
+        if ( m_stopCount > 2 )
+        {
+            for ( int i = 0; i < count; i++ )
+                m_inlineStops[ i ] = m_stops[ i ];
+
+            m_stops.clear();
+        }
+
+        for ( int i = count; i < 2; i++ )
+            m_inlineStops[ i ] = QskGradientStop();
+    }
+
+    m_stopCount = count;
+    m_hash.storeRelease( 0 );
+}
+
+QskGradientStop* QskGradient::detachedStops()
+{
+    m_hash.storeRelease( 0 );
+    return ( m_stopCount > 2 ) ? m_stops.data() : m_inlineStops;
+}
+
 bool QskGradient::isValid() const
 {
-    return qskIsGradientValid( m_stops );
+    return qskIsGradientValid( stopData(), m_stopCount );
 }
 
 void QskGradient::invalidate()
 {
-    m_stops.clear();
+    resizeStops( 0 );
 }
 
 bool QskGradient::isMonochrome() const
 {
-    if ( !qskIsGradientValid( m_stops ) )
+    const auto stops = stopData();
+
+    if ( !qskIsGradientValid( stops, m_stopCount ) )
         return true;
 
-    return qskIsMonochrome( m_stops );
+    return qskIsMonochrome( stops, m_stopCount );
 }
 
 bool QskGradient::isVisible() const
 {
     if ( isValid() )
     {
-        for ( const auto& stop : m_stops )
+        const auto stops = stopData();
+
+        for ( int i = 0; i < m_stopCount; i++ )
         {
-            const auto& c = stop.color();
+            const auto& c = stops[ i ].color();
             if ( c.isValid() && c.alpha() > 0 )
                 return true;
         }
@@ -304,6 +397,7 @@ void QskGradient::setOrientation( Qt::Orientation orientation )
 void QskGradient::setOrientation( Orientation orientation )
 {
     m_orientation = orientation;
+    m_hash.storeRelease( 0 );
 }
 
 QskGradient::Orientation QskGradient::orientation() const
@@ -313,40 +407,42 @@ QskGradient::Orientation QskGradient::orientation() const
 
 void QskGradient::setColor( const QColor& color )
 {
-    m_stops.reserve( 2 );
-
-    m_stops.append( QskGradientStop( 0.0, color ) );
-    m_stops.append( QskGradientStop( 1.0, color ) );
+    setColors( color, color );
 }
 
 void QskGradient::setColors( const QColor& startColor, const QColor& stopColor )
 {
-    m_stops.reserve( 2 );
+    resizeStops( 2 );
 
-    m_stops.append( QskGradientStop( 0.0, startColor ) );
-    m_stops.append( QskGradientStop( 1.0, stopColor ) );
+    auto stops = detachedStops();
+    stops[ 0 ] = QskGradientStop( 0.0, startColor );
+    stops[ 1 ] = QskGradientStop( 1.0, stopColor );
 }
 
 void QskGradient::setStops( const QVector< QskGradientStop >& stops )
 {
-    if ( !qskIsGradientValid( stops ) )
+    if ( !qskIsGradientValid( stops.constData(), stops.count() ) )
     {
         qWarning( "Invalid gradient stops" );
         invalidate();
         return;
     }
 
-    m_stops = stops;
+    assignStops( stops );
 }
 
 QVector< QskGradientStop > QskGradient::stops() const
 {
-    return m_stops;
-}
+    if ( m_stopCount > 2 )
+        return m_stops;
 
-int QskGradient::stopCount() const
-{
-    return m_stops.count();
+    QVector< QskGradientStop > stops;
+    stops.reserve( m_stopCount );
+
+    for ( int i = 0; i < m_stopCount; i++ )
+        stops += m_inlineStops[ i ];
+
+    return stops;
 }
 
 void QskGradient::setStopAt( int index, qreal stop )
@@ -357,18 +453,18 @@ void QskGradient::setStopAt( int index, qreal stop )
         return;
     }
 
-    if ( index >= m_stops.size() )
-        m_stops.resize( index + 1 );
+    if ( index >= m_stopCount )
+        resizeStops( index + 1 );
 
-    m_stops[ index ].setPosition( stop );
+    detachedStops()[ index ].setPosition( stop );
 }
 
 qreal QskGradient::stopAt( int index ) const
 {
-    if ( index >= m_stops.size() )
+    if ( index >= m_stopCount )
         return -1.0;
 
-    return m_stops[ index ].position();
+    return stopData()[ index ].position();
 }
 
 void QskGradient::setColorAt( int index, const QColor& color )
@@ -379,42 +475,46 @@ void QskGradient::setColorAt( int index, const QColor& color )
         return;
     }
 
-    if ( index >= m_stops.size() )
-        m_stops.resize( index + 1 );
+    if ( index >= m_stopCount )
+        resizeStops( index + 1 );
 
-    m_stops[ index ].setColor( color );
+    detachedStops()[ index ].setColor( color );
 }
 
 QColor QskGradient::colorAt( int index ) const
 {
-    if ( index >= m_stops.size() )
+    if ( index >= m_stopCount )
         return QColor();
 
-    return m_stops[ index ].color();
+    return stopData()[ index ].color();
 }
 
 void QskGradient::setAlpha( int alpha )
 {
-    for ( auto& stop : m_stops )
+    auto stops = detachedStops();
+
+    for ( int i = 0; i < m_stopCount; i++ )
     {
-        auto c = stop.color();
+        auto c = stops[ i ].color();
         if ( c.isValid() && c.alpha() )
         {
             c.setAlpha( alpha );
-            stop.setColor( c );
+            stops[ i ].setColor( c );
         }
     }
 }
 
 bool QskGradient::hasStopAt( qreal value ) const
 {
+    const auto stops = stopData();
+
     // better use binary search TODO ...
-    for ( auto& stop : m_stops )
+    for ( int i = 0; i < m_stopCount; i++ )
     {
-        if ( stop.position() == value )
+        if ( stops[ i ].position() == value )
             return true;
 
-        if ( stop.position() > value )
+        if ( stops[ i ].position() > value )
             break;
     }
 
@@ -423,15 +523,31 @@ bool QskGradient::hasStopAt( qreal value ) const
 
 uint QskGradient::hash( uint seed ) const
 {
-    const int count = m_stops.size();
-    if ( count == 0 )
+    if ( m_stopCount == 0 )
         return seed;
 
-    uint hash = qHashBits( &m_orientation, sizeof( m_orientation ), seed );
-    for ( const auto& stop : m_stops )
-        hash = stop.hash( hash );
+    auto hash = m_hash.loadAcquire();
+    if ( hash == 0 )
+    {
+        /*
+            Gradients are hashed for each update of a box node, but
+            are rarely modified. So we cache a hash, that does not depend
+            on the seed and combine it with the seed. Concurrent
+            calculations end up with the same value.
+         */
+        hash = qHashBits( &m_orientation, sizeof( m_orientation ) );
+
+        const auto stops = stopData();
+        for ( int i = 0; i < m_stopCount; i++ )
+            hash = stops[ i ].hash( hash );
+
+        if ( hash == 0 )
+            hash = 1;
 
-    return hash;
+        m_hash.storeRelease( hash );
+    }
+
+    return qHash( hash, seed );
 }
 
 void QskGradient::reverse()
@@ -439,9 +555,11 @@ void QskGradient::reverse()
     if ( isMonochrome() )
         return;
 
-    std::reverse( m_stops.begin(), m_stops.end() );
-    for( auto& stop : m_stops )
-        stop.setPosition( 1.0 - stop.position() );
+    auto stops = detachedStops();
+
+    std::reverse( stops, stops + m_stopCount );
+    for ( int i = 0; i < m_stopCount; i++ )
+        stops[ i ].setPosition( 1.0 - stops[ i ].position() );
 }
 
 QskGradient QskGradient::reversed() const
@@ -463,30 +581,35 @@ QskGradient QskGradient::extracted( qreal from, qreal to ) const
     from = qMax( from, 0.0 );
     to = qMin( to, 1.0 );
 
-    const auto stops = qskExtractedStops( m_stops, from, to );
+    const auto stops = qskExtractedStops( stopData(), m_stopCount, from, to );
     return QskGradient( m_orientation, stops );
 }
 
 QskGradient QskGradient::interpolated(
     const QskGradient& to, qreal value ) const
 {
+    /*
+        To avoid allocations we modify copies of the gradients, what
+        does not allocate for the common case of having 2 stops.
+     */
+
     if ( !( isValid() && to.isValid() ) )
     {
         if ( !isValid() && !to.isValid() )
             return to;
 
         qreal progress;
-        const QskGradient* gradient;
+        QskGradient gradient;
 
         if ( to.isValid() )
         {
             progress = value;
-            gradient = &to;
+            gradient = to;
         }
         else
         {
             progress = 1.0 - value;
-            gradient = this;
+            gradient = *this;
         }
 
         /*
@@ -494,48 +617,52 @@ QskGradient QskGradient::interpolated(
             a transparent version of the valid gradient
          */
 
-        auto stops = gradient->m_stops;
-        for ( auto& stop : stops )
+        auto stops = gradient.detachedStops();
+        for ( int i = 0; i < gradient.m_stopCount; i++ )
         {
-            auto c = stop.color();
+            auto c = stops[ i ].color();
             c.setAlpha( c.alpha() * progress );
 
-            stop.setColor( c );
+            stops[ i ].setColor( c );
         }
 
-        return QskGradient( gradient->m_orientation, stops );
+        return gradient;
     }
 
-    if ( qskIsMonochrome( m_stops ) )
+    if ( qskIsMonochrome( stopData(), m_stopCount ) )
     {
         // we can ignore our stops
 
-        const auto c = m_stops[ 0 ].color();
+        const auto c = stopData()[ 0 ].color();
+
+        auto gradient = to;
 
-        auto s2 = to.m_stops;
-        for ( int i = 0; i < s2.count(); i++ )
+        auto s2 = gradient.detachedStops();
+        for ( int i = 0; i < gradient.m_stopCount; i++ )
         {
             const auto c2 = QskRgb::interpolated( c, s2[ i ].color(), value );
             s2[ i ].setColor( c2 );
         }
 
-        return QskGradient( to.m_orientation, s2 );
+        return gradient;
     }
 
-    if ( qskIsMonochrome( to.m_stops ) )
+    if ( qskIsMonochrome( to.stopData(), to.m_stopCount ) )
     {
         // we can ignore the stops of to
 
-        const auto c = to.m_stops[ 0 ].color();
+        const auto c = to.stopData()[ 0 ].color();
 
-        auto s2 = m_stops;
-        for ( int i = 0; i < s2.count(); i++ )
+        auto gradient = *this;
+
+        auto s2 = gradient.detachedStops();
+        for ( int i = 0; i < gradient.m_stopCount; i++ )
         {
             const auto c2 = QskRgb::interpolated( s2[ i ].color(), c, value );
             s2[ i ].setColor( c2 );
         }
 
-        return QskGradient( m_orientation, s2 );
+        return gradient;
     }
 
     if ( m_orientation == to.m_orientation )
@@ -545,10 +672,29 @@ QskGradient QskGradient::interpolated(
             at the same positions
          */
 
-        const auto s1 = qskExpandedStops( m_stops, to.m_stops );
-        auto s2 = qskExpandedStops( to.m_stops, m_stops );
+        QskGradient gradient;
+
+        const QskGradientStop* s1;
+        QVector< QskGradientStop > expandedStops;
+
+        if ( qskComparePositions( stopData(), m_stopCount,
+            to.stopData(), to.m_stopCount ) )
+        {
+            gradient = to;
+            s1 = stopData();
+        }
+        else
+        {
+            gradient = QskGradient( m_orientation,
+                qskExpandedStops( to.stops(), stops() ) );
+
+            expandedStops = qskExpandedStops( stops(), to.stops() );
+            s1 = expandedStops.constData();
+        }
+
+        auto s2 = gradient.detachedStops();
 
-        for ( int i = 0; i < s1.count(); i++ )
+        for ( int i = 0; i < gradient.m_stopCount; i++ )
         {
             const auto c2 = QskRgb::interpolated(
                 s1[ i ].color(), s2[ i ].color(), value );
@@ -556,7 +702,7 @@ QskGradient QskGradient::interpolated(
             s2[ i ].setColor( c2 );
         }
 
-        return QskGradient( m_orientation, s2 );
+        return gradient;
     }
     else
     {
@@ -567,13 +713,14 @@ QskGradient QskGradient::interpolated(
             final gradient.
          */
 
-        const auto c = m_stops[ 0 ].color();
+        const auto c = stopData()[ 0 ].color();
 
         if ( value <= 0.5 )
         {
-            auto s2 = m_stops;
+            auto gradient = *this;
 
-            for ( int i = 0; i < s2.count(); i++ )
+            auto s2 = gradient.detachedStops();
+            for ( int i = 0; i < gradient.m_stopCount; i++ )
             {
                 const auto c2 = QskRgb::interpolated(
                     s2[ i ].color(), c, 2 * value );
@@ -581,13 +728,14 @@ QskGradient QskGradient::interpolated(
                 s2[ i ].setColor( c2 );
             }
 
-            return QskGradient( m_orientation, s2 );
+            return gradient;
         }
         else
         {
-            auto s2 = to.m_stops;
+            auto gradient = to;
 
-            for ( int i = 0; i < s2.count(); i++ )
+            auto s2 = gradient.detachedStops();
+            for ( int i = 0; i < gradient.m_stopCount; i++ )
             {
                 const auto c2 = QskRgb::interpolated(
                     c, s2[ i ].color(), 2 * ( value - 0.5 ) );
@@ -595,7 +743,7 @@ QskGradient QskGradient::interpolated(
                 s2[ i ].setColor( c2 );
             }
 
-            return QskGradient( to.m_orientation, s2 );
+            return gradient;
         }
     }
 }
@@ -618,7 +766,7 @@ QDebug operator<<( QDebug debug, const QskGradientStop& stop )
 
 QDebug operator<<( QDebug debug, const QskGradient& gradient )
 {
-    debug << "GR:" << gradient.orientation() << gradient.stops().count();
+    debug << "GR:" << gradient.orientation() << gradient.stopCount();
     return debug;
 }
 
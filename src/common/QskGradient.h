@@ -8,6 +8,7 @@
 
 #include "QskGlobal.h"
 
+#include <qatomic.h>
 #include <qcolor.h>
 #include <qmetatype.h>
 #include <qvector.h>
@@ -131,8 +132,29 @@ class QSK_EXPORT QskGradient
     void setStopAt( int index, qreal stop );
     void setColorAt( int index, const QColor& color );
 
+    void assignStops( const QVector< QskGradientStop >& );
+    void resizeStops( int count );
+
+    const QskGradientStop* stopData() const noexcept;
+    QskGradientStop* detachedStops();
+
     Orientation m_orientation;
+
+    /*
+        Gradients with up to 2 stops - by far the most common ones -
+        are stored in place. All others are stored in an implicitly
+        shared vector, that is detached only when being modified.
+     */
+    int m_stopCount = 0;
+    QskGradientStop m_inlineStops[ 2 ];
     QVector< QskGradientStop > m_stops;
+
+    /*
+        The hash is calculated on demand and reset, when modifying the gradient.
+        As gradients are hashed from the render threads, it is atomic:
+        0 means, that it has not been calculated yet.
+     */
+    mutable QAtomicInteger< uint > m_hash;
 };
 
 inline QskGradient::QskGradient( Qt::GlobalColor color )
@@ -145,14 +167,24 @@ inline QskGradient::QskGradient( QRgb rgb )
 {
 }
 
+inline const QskGradientStop* QskGradient::stopData() const noexcept
+{
+    return ( m_stopCount > 2 ) ? m_stops.constData() : m_inlineStops;
+}
+
 inline QColor QskGradient::startColor() const
 {
-    return ( m_stops.size() >= 2 ) ? m_stops.first().color() : QColor();
+    return ( m_stopCount >= 2 ) ? stopData()[ 0 ].color() : QColor();
 }
 
 inline QColor QskGradient::endColor() const
 {
-    return ( m_stops.size() >= 2 ) ? m_stops.last().color() : QColor();
+    return ( m_stopCount >= 2 ) ? stopData()[ m_stopCount - 1 ].color() : QColor();
+}
+
+inline int QskGradient::stopCount() const
+{
+    return m_stopCount;
 }
 
 inline QskGradientStop::QskGradientStop()
@@ -186,11 +218,6 @@ inline bool QskGradientStop::operator!=( const QskGradientStop& other ) const
     return ( !( *this == other ) );
 }
 
-inline bool QskGradient::operator==( const QskGradient& other ) const
-{
-    return ( m_orientation == other.m_orientation ) && ( m_stops == other.m_stops );
-}
-
 inline bool QskGradient::operator!=( const QskGradient& other ) const
 {
     return ( !( *this == other ) );
@@ -35,6 +35,8 @@ void QskBoundedControl::setMinimum( qreal minimum )
         adjustBoundaries( false );
 
     Q_EMIT boundariesChanged( boundaries() );
+
+    setStaticNodesDirty();
     update();
 }
 
@@ -55,6 +57,8 @@ void QskBoundedControl::setMaximum( qreal maximum )
         adjustBoundaries( true );
 
     Q_EMIT boundariesChanged( boundaries() );
+
+    setStaticNodesDirty();
     update();
 }
 
@@ -87,6 +91,8 @@ void QskBoundedControl::setBoundaries( qreal min, qreal max )
         Q_EMIT maximumChanged( m_maximum );
 
     Q_EMIT boundariesChanged( boundaries() );
+
+    setStaticNodesDirty();
     update();
 }
 
@@ -694,6 +694,13 @@ bool QskControl::event( QEvent* event )
 {
     switch ( static_cast< int >( event->type() ) )
     {
+        case QEvent::FontChange:
+        case QEvent::PaletteChange:
+        case QEvent::LayoutDirectionChange:
+        {
+            setStaticNodesDirty();
+            break;
+        }
         case QEvent::EnabledChange:
         {
             setSkinStateFlag( Disabled, !isEnabled() );
@@ -701,11 +708,18 @@ bool QskControl::event( QEvent* event )
         }
         case QEvent::LocaleChange:
         {
+            setStaticNodesDirty();
+
+            // f.e. number formats might depend on the locale
+            resetImplicitSize();
+
             Q_EMIT localeChanged( locale() );
             break;
         }
         case QEvent::ContentsRectChange:
         {
+            setStaticNodesDirty();
+
             resetImplicitSize();
             if ( d_func()->autoLayoutChildren )
                 polish();
@@ -726,6 +740,8 @@ bool QskControl::event( QEvent* event )
         {
             // The skin has changed
 
+            setStaticNodesDirty();
+
             if ( skinlet() == nullptr )
             {
                 /*
@@ -866,9 +882,11 @@ void QskControl::itemChange( QQuickItem::ItemChange change,
 void QskControl::geometryChange(
     const QRectF& newGeometry, const QRectF& oldGeometry )
 {
-    if ( d_func()->autoLayoutChildren )
+    if ( newGeometry.size() != oldGeometry.size() )
     {
-        if ( newGeometry.size() != oldGeometry.size() )
+        setStaticNodesDirty();
+
+        if ( d_func()->autoLayoutChildren )
             polish();
     }
 
@@ -909,7 +927,10 @@ void QskControl::updateItemPolish()
 QSGNode* QskControl::updateItemPaintNode( QSGNode* node )
 {
     if ( node == nullptr )
+    {
         node = new QSGNode;
+        setStaticNodesDirty();
+    }
 
     updateNode( node );
     return node;
@@ -17,6 +17,7 @@
 
 class QskControlPrivate;
 class QskGestureEvent;
+class QDebug;
 
 class QSK_EXPORT QskControl : public QskQuickItem, public QskSkinnable
 {
@@ -179,6 +180,20 @@ class QSK_EXPORT QskControl : public QskQuickItem, public QskSkinnable
 
     QVector< QskAspect::Subcontrol > subControls() const;
 
+    /*
+        Implicit size hints are cached until resetImplicitSize() is called.
+        Besides the unconstrained hints a couple of the most recent results
+        for heightForWidth/widthForHeight are kept.
+     */
+    static void setSizeHintCaching( bool );
+    static bool sizeHintCaching();
+
+    static void resetSizeHintStatistics();
+
+#ifndef QT_NO_DEBUG_STREAM
+    static void debugSizeHintStatistics( QDebug );
+#endif
+
   Q_SIGNALS:
     void backgroundChanged();
     void marginsChanged( const QMarginsF& );
@@ -7,6 +7,12 @@
 #include "QskSetup.h"
 #include "QskLayoutHint.h"
 
+#include <qatomic.h>
+
+#ifndef QT_NO_DEBUG_STREAM
+#include <qdebug.h>
+#endif
+
 static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 {
     QEvent event( type );
@@ -22,6 +28,103 @@ static inline QPointF qskScenePosition( const QMouseEvent* event )
 #endif
 }
 
+namespace
+{
+    /*
+        Size hints are also calculated from the worker threads
+        of QskItemBuilder, so the counters are atomic.
+     */
+    class SizeHintStatistics
+    {
+      public:
+        inline void reset()
+        {
+            hits.storeRelease( 0 );
+            misses.storeRelease( 0 );
+        }
+
+        QAtomicInteger< quint64 > hits;
+        QAtomicInteger< quint64 > misses;
+    };
+}
+
+static bool qskSizeHintCaching = true;
+static SizeHintStatistics qskSizeHintStatistics;
+
+class QskControlPrivate::SizeHintCache
+{
+  public:
+    inline bool find( Qt::SizeHint which,
+        const QSizeF& constraint, QSizeF& hint ) const
+    {
+        if ( constraint.width() < 0.0 && constraint.height() < 0.0 )
+        {
+            if ( !( validHints & ( 1 << which ) ) )
+                return false;
+
+            hint = hints[ which ];
+            return true;
+        }
+
+        for ( const auto& entry : entries )
+        {
+            if ( entry.which == which && entry.constraint == constraint )
+            {
+                hint = entry.hint;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline void insert( Qt::SizeHint which,
+        const QSizeF& constraint, const QSizeF& hint )
+    {
+        if ( constraint.width() < 0.0 && constraint.height() < 0.0 )
+        {
+            hints[ which ] = hint;
+            validHints |= ( 1 << which );
+        }
+        else
+        {
+            // replacing the oldest entry
+            auto& entry = entries[ nextEntry ];
+
+            entry.which = which;
+            entry.constraint = constraint;
+            entry.hint = hint;
+
+            nextEntry = ( nextEntry + 1 ) % EntryCount;
+        }
+    }
+
+    inline void clear()
+    {
+        validHints = 0;
+
+        for ( auto& entry : entries )
+            entry.which = Qt::NSizeHints;
+    }
+
+  private:
+    struct Entry
+    {
+        Qt::SizeHint which = Qt::NSizeHints;
+        QSizeF constraint;
+        QSizeF hint;
+    };
+
+    // usually a layout asks for the same constraints with each pass
+    enum { EntryCount = 4 };
+
+    QSizeF hints[ 3 ];
+    Entry entries[ EntryCount ];
+
+    quint8 validHints = 0;
+    quint8 nextEntry = 0;
+};
+
 /*
     Qt 5.12:
         sizeof( QQuickItemPrivate::ExtraData ) -> 184
@@ -47,6 +150,7 @@ static inline QPointF qskScenePosition( const QMouseEvent* event )
 
 QskControlPrivate::QskControlPrivate()
     : explicitSizeHints( nullptr )
+    , sizeHintCache( nullptr )
     , sizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Preferred )
     , layoutHints( 0 )
     , layoutAlignmentHint( 0 )
@@ -62,6 +166,7 @@ QskControlPrivate::QskControlPrivate()
 QskControlPrivate::~QskControlPrivate()
 {
     delete [] explicitSizeHints;
+    delete sizeHintCache;
 }
 
 void QskControlPrivate::layoutConstraintChanged()
@@ -92,8 +197,40 @@ QSizeF QskControlPrivate::implicitSizeHint() const
     return implicitSizeHint( Qt::PreferredSize, QSizeF() );
 }
 
+void QskControlPrivate::invalidateImplicitSizeHints()
+{
+    if ( sizeHintCache )
+        sizeHintCache->clear();
+}
+
 QSizeF QskControlPrivate::implicitSizeHint(
     Qt::SizeHint which, const QSizeF& constraint ) const
+{
+    if ( !qskSizeHintCaching )
+        return calculatedImplicitSizeHint( which, constraint );
+
+    if ( sizeHintCache == nullptr )
+        sizeHintCache = new SizeHintCache();
+
+    QSizeF hint;
+
+    if ( sizeHintCache->find( which, constraint, hint ) )
+    {
+        qskSizeHintStatistics.hits.fetchAndAddRelaxed( 1 );
+    }
+    else
+    {
+        qskSizeHintStatistics.misses.fetchAndAddRelaxed( 1 );
+
+        hint = calculatedImplicitSizeHint( which, constraint );
+        sizeHintCache->insert( which, constraint, hint );
+    }
+
+    return hint;
+}
+
+QSizeF QskControlPrivate::calculatedImplicitSizeHint(
+    Qt::SizeHint which, const QSizeF& constraint ) const
 {
     Q_Q( const QskControl );
 
@@ -265,3 +402,39 @@ void QskControlPrivate::resolveLocale( QskControl* control )
         qskSetup->inheritLocale( control, locale );
     }
 }
+
+void QskControl::setSizeHintCaching( bool on )
+{
+    qskSizeHintCaching = on;
+}
+
+bool QskControl::sizeHintCaching()
+{
+    return qskSizeHintCaching;
+}
+
+void QskControl::resetSizeHintStatistics()
+{
+    qskSizeHintStatistics.reset();
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+void QskControl::debugSizeHintStatistics( QDebug debug )
+{
+    const auto hits = qskSizeHintStatistics.hits.loadAcquire();
+    const auto misses = qskSizeHintStatistics.misses.loadAcquire();
+
+    const auto total = hits + misses;
+    const qreal hitRate = total ? qreal( hits ) / total : 0.0;
+
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+    debug << '(';
+    debug << "hits: " << hits
+          << ", misses: " << misses
+          << ", hit rate: " << hitRate;
+    debug << ')';
+}
+
+#endif
@@ -30,15 +30,21 @@ class QskControlPrivate : public QskQuickItemPrivate
     QSizeF implicitSizeHint( Qt::SizeHint, const QSizeF& ) const;
     QSizeF implicitSizeHint() const override final;
 
+    QSizeF calculatedImplicitSizeHint( Qt::SizeHint, const QSizeF& ) const;
+
     void implicitSizeChanged() override final;
     void layoutConstraintChanged() override final;
+    void invalidateImplicitSizeHints() override final;
 
     bool maybeGesture( QQuickItem*, QEvent* );
 
   private:
     Q_DECLARE_PUBLIC( QskControl )
 
+    class SizeHintCache;
+
     QSizeF* explicitSizeHints;
+    mutable SizeHintCache* sizeHintCache;
 
     QLocale locale;
 
@@ -13,9 +13,13 @@ QSK_QT_PRIVATE_END
 
 static inline bool qskIsUpdateBlocked( const QQuickItem* item )
 {
-    if ( !item->isVisible() )
+    if ( auto qskItem = qobject_cast< const QskQuickItem* >( item ) )
     {
-        if ( auto qskItem = qobject_cast< const QskQuickItem* >( item ) )
+        // items outside of the viewport of a scroll area
+        if ( qskItem->isCulled() )
+            return true;
+
+        if ( !item->isVisible() )
             return qskItem->testUpdateFlag( QskQuickItem::DeferredUpdate );
     }
 
@@ -24,6 +28,8 @@ static inline bool qskIsUpdateBlocked( const QQuickItem* item )
         Blocking items, that are outside the window would be easy,
         but we have not yet found a performant way to send update notifications
         when an item enters/leaves the window. TODO ...
+
+        For items inside of a scroll area: see QskScrollArea::setViewportCulling
      */
     else if ( const auto control = qskControlCast( item ) )
     {
@@ -138,6 +138,7 @@ void QskHintAnimator::advance( qreal progress )
                     m_control->polish();
             }
 
+            m_control->setStaticNodesDirty();
             m_control->update();
         }
         else
@@ -149,7 +150,10 @@ void QskHintAnimator::advance( qreal progress )
                 m_control->polish();
 
             if ( m_updateFlags & QskAnimationHint::UpdateNode )
+            {
+                m_control->setStaticNodesDirty();
                 m_control->update();
+            }
         }
     }
 }
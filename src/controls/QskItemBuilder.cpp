@@ -0,0 +1,234 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskItemBuilder.h"
+#include "QskControl.h"
+#include "QskSetup.h"
+#include "QskSkin.h"
+
+#include <qatomic.h>
+#include <qcoreapplication.h>
+#include <qdebug.h>
+#include <qpointer.h>
+#include <qquickitem.h>
+#include <qreadwritelock.h>
+#include <qrunnable.h>
+#include <qthread.h>
+#include <qthreadpool.h>
+#include <qvector.h>
+
+extern void qskRegisterItem( QskQuickItem* );
+extern QReadWriteLock* qskSkinLock();
+
+static const int qskDeliverEventType = QEvent::registerEventType();
+
+static void qskPrepareTree( QQuickItem* item )
+{
+    const auto children = item->childItems();
+    for ( auto child : children )
+        qskPrepareTree( child );
+
+    if ( auto control = qobject_cast< QskControl* >( item ) )
+    {
+        ( void ) control->effectiveSkinlet();
+
+        /*
+            The hints end up in the size hint caches of the controls
+            and the following layout calculations in the GUI thread
+            are cache hits.
+         */
+        ( void ) control->effectiveSizeHint( Qt::MinimumSize );
+        ( void ) control->effectiveSizeHint( Qt::PreferredSize );
+    }
+}
+
+static void qskMoveTree( QQuickItem* item, QThread* thread )
+{
+    if ( item->thread() != thread )
+    {
+        // only objects without a parent can be moved
+        QObject* object = item;
+        while ( object->parent() )
+            object = object->parent();
+
+        object->moveToThread( thread );
+    }
+
+    const auto children = item->childItems();
+    for ( auto child : children )
+        qskMoveTree( child, thread );
+}
+
+static void qskAttachTree( QQuickItem* item, bool skinChanged )
+{
+    if ( auto qskItem = qobject_cast< QskQuickItem* >( item ) )
+    {
+        qskRegisterItem( qskItem );
+
+        if ( skinChanged )
+        {
+            QEvent event( QEvent::StyleChange );
+            QCoreApplication::sendEvent( qskItem, &event );
+        }
+    }
+
+    const auto children = item->childItems();
+    for ( auto child : children )
+        qskAttachTree( child, skinChanged );
+}
+
+class QskItemBuilder::Job final : public QObject
+{
+  public:
+    Job( QskItemBuilder* builder, const Factory& factory )
+        : builder( builder )
+        , factory( factory )
+        , skin( qskSetup->skin() )
+    {
+    }
+
+    bool event( QEvent* event ) override
+    {
+        if ( event->type() == qskDeliverEventType )
+        {
+            deliver();
+            deleteLater();
+
+            return true;
+        }
+
+        return QObject::event( event );
+    }
+
+    QPointer< QskItemBuilder > builder;
+    const Factory factory;
+
+    QAtomicInt canceled;
+    QQuickItem* item = nullptr;
+
+  private:
+    void deliver()
+    {
+        if ( builder && !canceled.loadAcquire() )
+        {
+            builder->m_data->jobs.removeOne( this );
+
+            if ( item )
+                qskAttachTree( item, qskSetup->skin() != skin );
+
+            Q_EMIT builder->finished( item );
+        }
+        else
+        {
+            delete item;
+        }
+
+        item = nullptr;
+    }
+
+    const QPointer< QskSkin > skin;
+};
+
+class QskItemBuilder::Runnable final : public QRunnable
+{
+  public:
+    Runnable( Job* job, QThread* thread )
+        : m_job( job )
+        , m_thread( thread )
+    {
+    }
+
+    void run() override
+    {
+        QQuickItem* item = nullptr;
+
+        {
+            /*
+                The skin can't be replaced while building, but its
+                hint table is read without any further synchronization.
+                See QskItemBuilder.h
+             */
+            QReadLocker locker( qskSkinLock() );
+
+            if ( !m_job->canceled.loadAcquire() )
+                item = m_job->factory();
+
+            if ( item )
+            {
+                if ( item->parentItem() )
+                {
+                    qWarning() << "QskItemBuilder: the factory did not create"
+                        << "a detached item tree" << item;
+                }
+
+                if ( !m_job->canceled.loadAcquire() )
+                    qskPrepareTree( item );
+
+                if ( m_job->canceled.loadAcquire() )
+                {
+                    delete item;
+                    item = nullptr;
+                }
+            }
+        }
+
+        if ( item )
+            qskMoveTree( item, m_thread );
+
+        m_job->item = item;
+
+        // the job lives in the GUI thread, where it receives the result
+        QCoreApplication::postEvent( m_job,
+            new QEvent( static_cast< QEvent::Type >( qskDeliverEventType ) ) );
+    }
+
+  private:
+    Job* m_job;
+    QThread* m_thread;
+};
+
+class QskItemBuilder::PrivateData
+{
+  public:
+    QVector< Job* > jobs;
+};
+
+QskItemBuilder::QskItemBuilder( QObject* parent )
+    : QObject( parent )
+    , m_data( new PrivateData() )
+{
+}
+
+QskItemBuilder::~QskItemBuilder()
+{
+    cancel();
+}
+
+void QskItemBuilder::build( const Factory& factory )
+{
+    if ( factory == nullptr )
+        return;
+
+    auto job = new Job( this, factory );
+    m_data->jobs += job;
+
+    auto thread = QCoreApplication::instance()->thread();
+    QThreadPool::globalInstance()->start( new Runnable( job, thread ) );
+}
+
+bool QskItemBuilder::isRunning() const
+{
+    return !m_data->jobs.isEmpty();
+}
+
+void QskItemBuilder::cancel()
+{
+    for ( auto job : qskAsConst( m_data->jobs ) )
+        job->canceled.storeRelease( 1 );
+
+    m_data->jobs.clear();
+}
+
+#include "moc_QskItemBuilder.cpp"
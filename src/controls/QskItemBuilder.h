@@ -0,0 +1,63 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_ITEM_BUILDER_H
+#define QSK_ITEM_BUILDER_H
+
+#include "QskGlobal.h"
+
+#include <qobject.h>
+#include <functional>
+#include <memory>
+
+class QQuickItem;
+
+/*
+    QskItemBuilder creates an item tree in a worker thread and hands
+    it over to the GUI thread, when being completed.
+
+    The factory creates a detached tree ( no parentItem ) and sets it up
+    like it would do in the GUI thread. The builder resolves the skinlets
+    and precalculates the implicit size hints of all controls, before
+    moving the tree into the GUI thread.
+
+    Inside of the factory any operation, that involves a window
+    - like inserting an item into the scene - must not be done.
+
+    The hints of the skin are read from the worker thread without
+    locking. Replacing the skin ( QskSetup::setSkin ) waits for running
+    builds, but modifications of the hint table of the current skin
+    must not be done, while a build is running.
+ */
+class QSK_EXPORT QskItemBuilder : public QObject
+{
+    Q_OBJECT
+
+  public:
+    using Factory = std::function< QQuickItem*() >;
+
+    QskItemBuilder( QObject* parent = nullptr );
+    ~QskItemBuilder() override;
+
+    void build( const Factory& );
+
+    bool isRunning() const;
+
+    // the pending results will be deleted
+    void cancel();
+
+  Q_SIGNALS:
+    // ownership is transferred to the receiver
+    void finished( QQuickItem* );
+
+  private:
+    class Job;
+    class Runnable;
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
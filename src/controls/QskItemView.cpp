@@ -0,0 +1,651 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskItemView.h"
+#include "QskControl.h"
+#include "QskQuick.h"
+
+#include <qbitarray.h>
+#include <qvector.h>
+
+namespace
+{
+    /*
+        The heights of the rows - estimated or measured - organized as
+        Fenwick tree, so that finding the offset of a row or the row
+        at an offset is O(log n). This is what makes scrolling through
+        hundreds of thousands of rows with variable heights cheap.
+     */
+    class RowIndex
+    {
+      public:
+        void reset( int count, qreal height )
+        {
+            m_heights.fill( height, count );
+            m_measured.fill( false, count );
+
+            rebuild();
+        }
+
+        void setSpacing( qreal spacing )
+        {
+            m_spacing = spacing;
+            rebuild();
+        }
+
+        void setEstimatedHeight( qreal height )
+        {
+            for ( int row = 0; row < m_heights.size(); row++ )
+            {
+                if ( !m_measured.testBit( row ) )
+                    m_heights[ row ] = height;
+            }
+
+            rebuild();
+        }
+
+        void invalidate( int from, int to )
+        {
+            // the heights are kept as better estimations
+            from = qMax( from, 0 );
+            to = qMin( to, count() );
+
+            if ( from < to )
+                m_measured.fill( false, from, to );
+        }
+
+        inline int count() const { return m_heights.size(); }
+        inline bool isMeasured( int row ) const { return m_measured.testBit( row ); }
+        inline qreal height( int row ) const { return m_heights[ row ]; }
+
+        void setHeight( int row, qreal height )
+        {
+            m_measured.setBit( row );
+
+            const qreal delta = height - m_heights[ row ];
+            if ( delta != 0.0 )
+            {
+                m_heights[ row ] = height;
+
+                for ( int i = row + 1; i < m_tree.size(); i += i & -i )
+                    m_tree[ i ] += delta;
+            }
+        }
+
+        qreal offset( int row ) const
+        {
+            qreal y = 0.0;
+
+            for ( int i = qMin( row, count() ); i > 0; i -= i & -i )
+                y += m_tree[ i ];
+
+            return y;
+        }
+
+        qreal totalHeight() const
+        {
+            return ( count() > 0 ) ? offset( count() ) - m_spacing : 0.0;
+        }
+
+        int rowAt( qreal y ) const
+        {
+            const int n = count();
+            if ( n == 0 )
+                return -1;
+
+            int step = 1;
+            while ( 2 * step <= n )
+                step *= 2;
+
+            int row = 0;
+
+            for ( ; step > 0; step /= 2 )
+            {
+                const int i = row + step;
+                if ( i <= n && m_tree[ i ] <= y )
+                {
+                    row = i;
+                    y -= m_tree[ i ];
+                }
+            }
+
+            return qMin( row, n - 1 );
+        }
+
+      private:
+        void rebuild()
+        {
+            const int n = count();
+
+            m_tree.resize( n + 1 );
+            m_tree[ 0 ] = 0.0;
+
+            for ( int i = 1; i <= n; i++ )
+                m_tree[ i ] = m_heights[ i - 1 ] + m_spacing;
+
+            for ( int i = 1; i <= n; i++ )
+            {
+                const int j = i + ( i & -i );
+                if ( j <= n )
+                    m_tree[ j ] += m_tree[ i ];
+            }
+        }
+
+        qreal m_spacing = 0.0;
+
+        QVector< qreal > m_heights;
+        QBitArray m_measured;
+
+        // 1-based, each entry including the spacing
+        QVector< qreal > m_tree;
+    };
+}
+
+class QskItemView::ContentItem final : public QQuickItem
+{
+  public:
+    ContentItem( QskItemView* view )
+        : QQuickItem( view )
+        , m_view( view )
+    {
+    }
+
+  protected:
+    bool event( QEvent* event ) override
+    {
+        if ( event->type() == QEvent::LayoutRequest )
+        {
+            /*
+                The size hints of a delegate have changed. We don't know
+                which one, but there are only a couple of active rows.
+             */
+            m_view->invalidateRows( 0, -1 );
+            return true;
+        }
+
+        return QQuickItem::event( event );
+    }
+
+    void itemChange( ItemChange change, const ItemChangeData& value ) override
+    {
+        QQuickItem::itemChange( change, value );
+
+        if ( change == QQuickItem::ItemChildRemovedChange )
+        {
+            if ( auto control = qobject_cast< QskControl* >( value.item ) )
+                m_view->removeDelegate( control );
+        }
+    }
+
+  private:
+    QskItemView* m_view;
+};
+
+class QskItemView::PrivateData
+{
+  public:
+    PrivateData()
+        : isDirty( true )
+        , isLayouting( false )
+    {
+    }
+
+    inline int rowCount() const
+    {
+        return ( itemCount + columnCount - 1 ) / columnCount;
+    }
+
+    ContentItem* contentItem = nullptr;
+
+    RowIndex rowIndex;
+
+    /*
+        The delegates of the rows in the viewport: delegates[i]
+        is bound to the entry firstIndex + i. Delegates being
+        scrolled out are hidden and kept in the pool.
+     */
+    QVector< QskControl* > delegates;
+    QVector< QskControl* > pool;
+
+    int firstIndex = 0;
+    int itemCount = 0;
+
+    int columnCount = 1;
+
+    qreal estimatedRowHeight = 40.0;
+    qreal spacing = 0.0;
+    qreal prefetchMargin = 100.0;
+
+    qreal cellWidth = -1.0;
+
+    bool isDirty : 1;
+    bool isLayouting : 1;
+};
+
+QskItemView::QskItemView( QQuickItem* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+    setItemResizable( false );
+    setFlickableOrientations( Qt::Vertical );
+    setHorizontalScrollBarPolicy( Qt::ScrollBarAlwaysOff );
+
+    m_data->contentItem = new ContentItem( this );
+    setScrolledItem( m_data->contentItem );
+
+    connect( this, &QskScrollBox::scrollPosChanged, this,
+        [ this ] { if ( !m_data->isLayouting ) polish(); } );
+}
+
+QskItemView::~QskItemView()
+{
+    // deleting the content item with all delegates, while m_data is alive
+    setScrolledItem( nullptr );
+}
+
+void QskItemView::setColumnCount( int count )
+{
+    count = qMax( count, 1 );
+
+    if ( count != m_data->columnCount )
+    {
+        m_data->columnCount = count;
+        reset();
+
+        Q_EMIT columnCountChanged( count );
+    }
+}
+
+int QskItemView::columnCount() const
+{
+    return m_data->columnCount;
+}
+
+void QskItemView::setEstimatedRowHeight( qreal height )
+{
+    height = qMax( height, 1.0 );
+
+    if ( height != m_data->estimatedRowHeight )
+    {
+        m_data->estimatedRowHeight = height;
+
+        if ( !m_data->isDirty )
+        {
+            m_data->rowIndex.setEstimatedHeight( height );
+            polish();
+        }
+
+        Q_EMIT estimatedRowHeightChanged( height );
+    }
+}
+
+qreal QskItemView::estimatedRowHeight() const
+{
+    return m_data->estimatedRowHeight;
+}
+
+void QskItemView::setSpacing( qreal spacing )
+{
+    spacing = qMax( spacing, 0.0 );
+
+    if ( spacing != m_data->spacing )
+    {
+        m_data->spacing = spacing;
+
+        m_data->rowIndex.setSpacing( spacing );
+        polish();
+
+        Q_EMIT spacingChanged( spacing );
+    }
+}
+
+qreal QskItemView::spacing() const
+{
+    return m_data->spacing;
+}
+
+void QskItemView::setPrefetchMargin( qreal margin )
+{
+    margin = qMax( margin, 0.0 );
+
+    if ( margin != m_data->prefetchMargin )
+    {
+        m_data->prefetchMargin = margin;
+        polish();
+
+        Q_EMIT prefetchMarginChanged( margin );
+    }
+}
+
+qreal QskItemView::prefetchMargin() const
+{
+    return m_data->prefetchMargin;
+}
+
+QskControl* QskItemView::delegateAt( int index ) const
+{
+    const int pos = index - m_data->firstIndex;
+    if ( pos >= 0 && pos < m_data->delegates.size() )
+        return m_data->delegates[ pos ];
+
+    return nullptr;
+}
+
+int QskItemView::indexOf( const QskControl* delegate ) const
+{
+    if ( delegate )
+    {
+        const int pos = m_data->delegates.indexOf( const_cast< QskControl* >( delegate ) );
+        if ( pos >= 0 )
+            return m_data->firstIndex + pos;
+    }
+
+    return -1;
+}
+
+int QskItemView::rowAt( qreal y ) const
+{
+    if ( y < 0.0 || y > m_data->rowIndex.totalHeight() )
+        return -1;
+
+    return m_data->rowIndex.rowAt( y );
+}
+
+QRectF QskItemView::rowRect( int row ) const
+{
+    const auto& rowIndex = m_data->rowIndex;
+
+    if ( row < 0 || row >= rowIndex.count() )
+        return QRectF();
+
+    return QRectF( 0.0, rowIndex.offset( row ),
+        m_data->contentItem->width(), rowIndex.height( row ) );
+}
+
+int QskItemView::activeDelegateCount() const
+{
+    return m_data->delegates.size() - m_data->delegates.count( nullptr );
+}
+
+int QskItemView::pooledDelegateCount() const
+{
+    return m_data->pool.size();
+}
+
+void QskItemView::reset()
+{
+    m_data->isDirty = true;
+    polish();
+}
+
+void QskItemView::updateItem( int index )
+{
+    if ( index < 0 || index >= m_data->itemCount )
+        return;
+
+    if ( auto delegate = delegateAt( index ) )
+        updateDelegate( delegate, index );
+
+    const int row = index / m_data->columnCount;
+    m_data->rowIndex.invalidate( row, row + 1 );
+
+    polish();
+}
+
+void QskItemView::ensureIndexVisible( int index )
+{
+    if ( index >= 0 && index < m_data->itemCount )
+        ensureVisible( rowRect( index / m_data->columnCount ) );
+}
+
+void QskItemView::releaseDelegate( QskControl*, int )
+{
+}
+
+void QskItemView::invalidateRows( int from, int to )
+{
+    if ( m_data->isLayouting )
+    {
+        // showing/hiding/rebinding of delegates in layoutDelegates
+        return;
+    }
+
+    if ( to < 0 )
+    {
+        // all active rows
+        const int columnCount = m_data->columnCount;
+
+        from = m_data->firstIndex / columnCount;
+        to = ( m_data->firstIndex + m_data->delegates.size()
+            + columnCount - 1 ) / columnCount;
+    }
+
+    m_data->rowIndex.invalidate( from, to );
+    polish();
+}
+
+void QskItemView::removeDelegate( QskControl* delegate )
+{
+    // a delegate has been deleted or reparented from outside
+
+    const int pos = m_data->delegates.indexOf( delegate );
+    if ( pos >= 0 )
+        m_data->delegates[ pos ] = nullptr;
+
+    m_data->pool.removeAll( delegate );
+
+    if ( !m_data->isLayouting )
+        polish();
+}
+
+void QskItemView::updateLayout()
+{
+    m_data->isLayouting = true;
+
+    auto contentItem = m_data->contentItem;
+
+    if ( m_data->isDirty )
+    {
+        for ( int i = 0; i < m_data->delegates.size(); i++ )
+        {
+            if ( auto delegate = m_data->delegates[ i ] )
+            {
+                releaseDelegate( delegate, m_data->firstIndex + i );
+                delegate->setVisible( false );
+
+                m_data->pool += delegate;
+            }
+        }
+
+        m_data->delegates.clear();
+        m_data->firstIndex = 0;
+
+        m_data->itemCount = qMax( count(), 0 );
+        m_data->rowIndex.reset( m_data->rowCount(), m_data->estimatedRowHeight );
+
+        m_data->isDirty = false;
+    }
+
+    /*
+        The size of the content item decides about the vertical scroll bar,
+        and the scroll bar about the width of the cells.
+     */
+    contentItem->setHeight( m_data->rowIndex.totalHeight() );
+
+    Inherited::updateLayout();
+
+    const qreal width = viewContentsRect().width();
+    contentItem->setWidth( width );
+
+    const int columnCount = m_data->columnCount;
+    const qreal cellWidth = qMax( 0.0,
+        ( width - ( columnCount - 1 ) * m_data->spacing ) / columnCount );
+
+    if ( cellWidth != m_data->cellWidth )
+    {
+        m_data->cellWidth = cellWidth;
+        m_data->rowIndex.invalidate( 0, m_data->rowIndex.count() );
+    }
+
+    layoutDelegates();
+
+    m_data->isLayouting = false;
+}
+
+void QskItemView::layoutDelegates()
+{
+    auto& rowIndex = m_data->rowIndex;
+
+    const int columnCount = m_data->columnCount;
+    const int itemCount = m_data->itemCount;
+    const qreal cellWidth = m_data->cellWidth;
+
+    const auto viewRect = viewContentsRect();
+    const auto pos = scrollPos();
+
+    auto release = [ this ]( QskControl* delegate, int index )
+    {
+        releaseDelegate( delegate, index );
+        delegate->setVisible( false );
+
+        m_data->pool += delegate;
+    };
+
+    QVector< QskControl* > delegates;
+    int firstIndex = 0;
+
+    qreal anchorDelta = 0.0;
+
+    if ( itemCount > 0 && cellWidth > 0.0 && !viewRect.isEmpty() )
+    {
+        const qreal top = qMax( pos.y() - m_data->prefetchMargin, 0.0 );
+        const qreal bottom = pos.y() + viewRect.height() + m_data->prefetchMargin;
+
+        int row = rowIndex.rowAt( top );
+        firstIndex = row * columnCount;
+
+        {
+            /*
+                Moving the delegates, that are not needed anymore, to the pool
+                before binding the new ones. Otherwise we would create new
+                delegates, while having unused ones.
+             */
+            const int lastIndex = qMin( itemCount,
+                ( rowIndex.rowAt( bottom ) + 1 ) * columnCount );
+
+            for ( int i = 0; i < m_data->delegates.size(); i++ )
+            {
+                const int index = m_data->firstIndex + i;
+                if ( index < firstIndex || index >= lastIndex )
+                {
+                    if ( auto delegate = m_data->delegates[ i ] )
+                    {
+                        release( delegate, index );
+                        m_data->delegates[ i ] = nullptr;
+                    }
+                }
+            }
+        }
+
+        auto takeDelegate = [ this ]( int index )
+        {
+            const int i = index - m_data->firstIndex;
+            if ( i >= 0 && i < m_data->delegates.size() )
+            {
+                if ( auto delegate = m_data->delegates[ i ] )
+                {
+                    // still bound to the same entry
+                    m_data->delegates[ i ] = nullptr;
+                    return delegate;
+                }
+            }
+
+            QskControl* delegate = nullptr;
+
+            if ( !m_data->pool.isEmpty() )
+            {
+                delegate = m_data->pool.takeLast();
+                delegate->setVisible( true );
+            }
+            else
+            {
+                delegate = createDelegate();
+                Q_ASSERT( delegate );
+
+                delegate->setParentItem( m_data->contentItem );
+                if ( delegate->parent() == nullptr )
+                    delegate->setParent( m_data->contentItem );
+            }
+
+            updateDelegate( delegate, index );
+            return delegate;
+        };
+
+        const int anchorRow = rowIndex.rowAt( pos.y() );
+        const qreal anchorOffset = rowIndex.offset( anchorRow );
+
+        qreal y = rowIndex.offset( row );
+
+        while ( row < rowIndex.count() && y < bottom )
+        {
+            const int from = row * columnCount;
+            const int to = qMin( from + columnCount, itemCount );
+
+            for ( int index = from; index < to; index++ )
+                delegates += takeDelegate( index );
+
+            if ( !rowIndex.isMeasured( row ) )
+            {
+                qreal height = 0.0;
+
+                for ( int index = from; index < to; index++ )
+                {
+                    const auto delegate = delegates[ index - firstIndex ];
+                    height = qMax( height,
+                        qskHeightForWidth( delegate, Qt::PreferredSize, cellWidth ) );
+                }
+
+                if ( height <= 0.0 )
+                    height = m_data->estimatedRowHeight;
+
+                rowIndex.setHeight( row, height );
+            }
+
+            const qreal height = rowIndex.height( row );
+
+            for ( int index = from; index < to; index++ )
+            {
+                const qreal x = ( index - from ) * ( cellWidth + m_data->spacing );
+                qskSetItemGeometry( delegates[ index - firstIndex ], x, y, cellWidth, height );
+            }
+
+            y += height + m_data->spacing;
+            row++;
+        }
+
+        /*
+            The rows above the viewport might have been measured with
+            a different height than estimated. We adjust the scroll
+            position, so that the content in the viewport does not jump.
+         */
+        anchorDelta = rowIndex.offset( anchorRow ) - anchorOffset;
+    }
+
+    for ( int i = 0; i < m_data->delegates.size(); i++ )
+    {
+        if ( auto delegate = m_data->delegates[ i ] )
+            release( delegate, m_data->firstIndex + i );
+    }
+
+    m_data->delegates = delegates;
+    m_data->firstIndex = firstIndex;
+
+    m_data->contentItem->setHeight( rowIndex.totalHeight() );
+
+    setScrollableSize( m_data->contentItem->size() );
+    setScrollPos( pos + QPointF( 0.0, anchorDelta ) );
+}
+
+#include "moc_QskItemView.cpp"
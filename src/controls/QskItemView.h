@@ -0,0 +1,108 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_ITEM_VIEW_H
+#define QSK_ITEM_VIEW_H
+
+#include "QskScrollArea.h"
+
+class QskControl;
+
+/*
+    QskItemView displays a model of count() entries by real controls, that
+    are laid out in rows of columnCount() cells.
+
+    Delegates are only instantiated for the rows inside of the viewport -
+    expanded by the prefetch margin. Delegates, that are scrolled out,
+    are kept in a pool and rebound to the entries coming into the viewport,
+    so that the number of controls does not depend on the size of the model.
+
+    The height of a row is the maximum of the preferred heights of its
+    delegates. As long as a row has not been displayed, its height is
+    estimated - the scrollable size gets more accurate while scrolling.
+ */
+class QSK_EXPORT QskItemView : public QskScrollArea
+{
+    Q_OBJECT
+
+    Q_PROPERTY( int columnCount READ columnCount
+        WRITE setColumnCount NOTIFY columnCountChanged FINAL )
+
+    Q_PROPERTY( qreal estimatedRowHeight READ estimatedRowHeight
+        WRITE setEstimatedRowHeight NOTIFY estimatedRowHeightChanged FINAL )
+
+    Q_PROPERTY( qreal spacing READ spacing
+        WRITE setSpacing NOTIFY spacingChanged FINAL )
+
+    Q_PROPERTY( qreal prefetchMargin READ prefetchMargin
+        WRITE setPrefetchMargin NOTIFY prefetchMarginChanged FINAL )
+
+    using Inherited = QskScrollArea;
+
+  public:
+    QskItemView( QQuickItem* parent = nullptr );
+    ~QskItemView() override;
+
+    void setColumnCount( int );
+    int columnCount() const;
+
+    void setEstimatedRowHeight( qreal );
+    qreal estimatedRowHeight() const;
+
+    void setSpacing( qreal );
+    qreal spacing() const;
+
+    void setPrefetchMargin( qreal );
+    qreal prefetchMargin() const;
+
+    virtual int count() const = 0;
+
+    // nullptr, when the entry is not instantiated
+    QskControl* delegateAt( int index ) const;
+    int indexOf( const QskControl* ) const;
+
+    int rowAt( qreal y ) const;
+    QRectF rowRect( int row ) const;
+
+    // counters of the most recent layout pass
+    int activeDelegateCount() const;
+    int pooledDelegateCount() const;
+
+  Q_SIGNALS:
+    void columnCountChanged( int );
+    void estimatedRowHeightChanged( qreal );
+    void spacingChanged( qreal );
+    void prefetchMarginChanged( qreal );
+
+  public Q_SLOTS:
+    // to be called, when the number of entries has changed
+    void reset();
+
+    // to be called, when the content of an entry has changed
+    void updateItem( int index );
+
+    void ensureIndexVisible( int index );
+
+  protected:
+    virtual QskControl* createDelegate() = 0;
+    virtual void updateDelegate( QskControl*, int index ) = 0;
+
+    // called, before a delegate is moved into the pool
+    virtual void releaseDelegate( QskControl*, int index );
+
+    void updateLayout() override;
+
+  private:
+    void layoutDelegates();
+    void invalidateRows( int from, int to );
+    void removeDelegate( QskControl* );
+
+    class ContentItem;
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
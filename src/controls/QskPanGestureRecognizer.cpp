@@ -76,63 +76,96 @@ namespace
 {
     class VelocityTracker
     {
+        /*
+            The velocity is the slope of a least squares fit of the positions
+            over a short time window, using the timestamps of the events.
+            Compared to averaging the velocities between succeeding
+            events this is much less sensitive to jitter in the event
+            delivery - f.e. when having more than one event per frame.
+         */
+
       public:
         VelocityTracker()
         {
             reset();
         }
 
-        void record( int elapsed, qreal velocity )
+        inline void record( ulong timestamp, const QPointF& pos )
         {
-            if ( ( velocity != 0.0 ) && ( m_values[ m_pos ].velocity != 0.0 ) )
-            {
-                if ( ( velocity > 0.0 ) != ( m_values[ m_pos ].velocity > 0.0 ) )
-                    reset(); // direction has changed
-            }
-
-            m_values[ m_pos ].elapsed = elapsed;
-            m_values[ m_pos ].velocity = velocity;
+            m_samples[ m_pos ].timestamp = timestamp;
+            m_samples[ m_pos ].pos = pos;
 
             m_pos = ( m_pos + 1 ) % Count;
+            m_count = qMin( m_count + 1, int( Count ) );
         }
 
         inline void reset()
         {
-            for ( auto& v : m_values )
-            {
-                v.elapsed = -1;
-                v.velocity = 0;
-            }
-            m_pos = 0;
+            m_pos = m_count = 0;
         }
 
-        inline qreal velocity( ulong elapsed ) const
+        // pixels per second
+        QPointF velocity( ulong timestamp ) const
         {
-            qreal sum = 0;
-            int numVelocities = 0;
+            int n = 0;
+            qreal sumT = 0.0;
+            QPointF sumPos;
 
-            for ( const auto& v : m_values )
+            for ( int i = 0; i < m_count; i++ )
             {
-                // only swipe events within the last 500 ms will be considered
-                if ( v.elapsed > 0 && ( elapsed - v.elapsed ) <= 500 )
+                const auto& sample = m_samples[ i ];
+                if ( timestamp - sample.timestamp <= Window )
                 {
-                    sum += v.velocity;
-                    numVelocities++;
+                    sumT += seconds( sample.timestamp, timestamp );
+                    sumPos += sample.pos;
+                    n++;
                 }
             }
 
-            return ( numVelocities > 0 ) ? ( sum / numVelocities ) : 0.0;
+            if ( n < 2 )
+                return QPointF();
+
+            const qreal meanT = sumT / n;
+            const QPointF meanPos = sumPos / n;
+
+            qreal sumTT = 0.0;
+            QPointF sumTP;
+
+            for ( int i = 0; i < m_count; i++ )
+            {
+                const auto& sample = m_samples[ i ];
+                if ( timestamp - sample.timestamp <= Window )
+                {
+                    const qreal dt = seconds( sample.timestamp, timestamp ) - meanT;
+
+                    sumTT += dt * dt;
+                    sumTP += dt * ( sample.pos - meanPos );
+                }
+            }
+
+            if ( sumTT <= 0.0 )
+                return QPointF(); // all events with the same timestamp
+
+            return sumTP / sumTT;
         }
 
       private:
-        int m_pos = 0;
-        enum { Count = 3 };
+        static inline qreal seconds( ulong timestamp, ulong reference )
+        {
+            return -qreal( reference - timestamp ) / 1000.0;
+        }
+
+        enum { Count = 16 };
+        enum { Window = 100 }; // ms
 
         struct
         {
-            int elapsed = 0;
-            qreal velocity = 0.0;
-        } m_values[ Count ];
+            ulong timestamp;
+            QPointF pos;
+        } m_samples[ Count ];
+
+        int m_pos;
+        int m_count;
     };
 }
 
@@ -195,25 +228,17 @@ void QskPanGestureRecognizer::pressEvent( const QMouseEvent* event )
     m_data->timestamp = timestamp();
 
     m_data->velocityTracker.reset();
+    m_data->velocityTracker.record( m_data->timestamp, m_data->pos );
 }
 
 void QskPanGestureRecognizer::moveEvent( const QMouseEvent* event )
 {
-    const ulong elapsed = event->timestamp() - m_data->timestamp;
-    const ulong elapsedTotal = event->timestamp() - timestamp();
-
     const QPointF oldPos = m_data->pos;
 
     m_data->timestamp = event->timestamp();
     m_data->pos = qskMousePosition( event );
 
-    if ( elapsedTotal > 0 ) // ???
-    {
-        const qreal dist = qskDistance( oldPos, m_data->pos, m_data->orientations );
-
-        const qreal velocity = dist / ( elapsed / 1000.0 );
-        m_data->velocityTracker.record( elapsedTotal, velocity );
-    }
+    m_data->velocityTracker.record( m_data->timestamp, m_data->pos );
 
     bool started = false;
 
@@ -230,11 +255,16 @@ void QskPanGestureRecognizer::moveEvent( const QMouseEvent* event )
         }
     }
 
-    m_data->angle = qskAngle( oldPos, m_data->pos, m_data->orientations );
+    const auto v = m_data->velocityTracker.velocity( m_data->timestamp );
+
+    if ( v.isNull() )
+        m_data->angle = qskAngle( oldPos, m_data->pos, m_data->orientations );
+    else
+        m_data->angle = qskAngle( QPointF(), v, m_data->orientations );
 
     if ( state() == QskGestureRecognizer::Accepted )
     {
-        const qreal velocity = m_data->velocityTracker.velocity( elapsedTotal );
+        const qreal velocity = qskDistance( QPointF(), v, m_data->orientations );
 
         if ( started )
         {
@@ -253,8 +283,15 @@ void QskPanGestureRecognizer::releaseEvent( const QMouseEvent* event )
 {
     if ( state() == QskGestureRecognizer::Accepted )
     {
-        const ulong elapsedTotal = event->timestamp() - timestamp();
-        const qreal velocity = m_data->velocityTracker.velocity( elapsedTotal );
+        /*
+            When the finger has been resting before being lifted,
+            there are no samples in the time window and we have no velocity.
+         */
+        const auto v = m_data->velocityTracker.velocity( event->timestamp() );
+        const qreal velocity = qskDistance( QPointF(), v, m_data->orientations );
+
+        if ( !v.isNull() )
+            m_data->angle = qskAngle( QPointF(), v, m_data->orientations );
 
         qskSendPanGestureEvent( watchedItem(), QskGesture::Finished,
             velocity, m_data->angle, m_data->origin, m_data->pos, m_data->pos );
@@ -0,0 +1,251 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskPrewarmer.h"
+#include "QskGraphicProvider.h"
+#include "QskSetup.h"
+#include "QskSkin.h"
+
+#include <qbasictimer.h>
+#include <qelapsedtimer.h>
+#include <qpointer.h>
+#include <qstringlist.h>
+#include <qtextlayout.h>
+#include <qvector.h>
+
+#ifndef QT_NO_DEBUG_STREAM
+#include <qdebug.h>
+#endif
+
+#include <functional>
+
+static const QString& qskSampleText()
+{
+    static QString text;
+
+    if ( text.isEmpty() )
+    {
+        for ( char c = 0x20; c < 0x7f; c++ )
+            text += QLatin1Char( c );
+    }
+
+    return text;
+}
+
+static void qskWarmFont( const QFont& font )
+{
+    /*
+        Loading the font engine and doing the glyph lookups.
+        The glyph textures of the scene graph are created
+        in the render thread and can't be warmed up here.
+     */
+    QTextLayout layout( qskSampleText(), font );
+
+    layout.beginLayout();
+    layout.createLine();
+    layout.endLayout();
+
+    ( void ) layout.glyphRuns();
+}
+
+static inline int qskTaskIndex( QskPrewarmer::Task task )
+{
+    switch( task )
+    {
+        case QskPrewarmer::Skinlets:
+            return 0;
+
+        case QskPrewarmer::Graphics:
+            return 1;
+
+        default:
+            return 2;
+    }
+}
+
+namespace
+{
+    class Step
+    {
+      public:
+        QskPrewarmer::Task task;
+        std::function< void() > function;
+    };
+}
+
+class QskPrewarmer::PrivateData
+{
+  public:
+    QVector< Step > steps;
+    int stepIndex = 0;
+
+    int budget = 4;
+    QBasicTimer timer;
+
+    int counts[ 3 ] = { 0, 0, 0 };
+    qint64 busyTime = 0; // ns
+};
+
+QskPrewarmer::QskPrewarmer( QObject* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+}
+
+QskPrewarmer::~QskPrewarmer()
+{
+}
+
+void QskPrewarmer::setBudget( int ms )
+{
+    m_data->budget = qMax( ms, 1 );
+}
+
+int QskPrewarmer::budget() const
+{
+    return m_data->budget;
+}
+
+void QskPrewarmer::start( Tasks tasks )
+{
+    stop();
+
+    m_data->steps.clear();
+    m_data->stepIndex = 0;
+
+    for ( auto& count : m_data->counts )
+        count = 0;
+
+    m_data->busyTime = 0;
+
+    QPointer< QskSkin > skin = qskSetup->skin();
+
+    if ( tasks & Skinlets )
+    {
+        const auto metaObjects = skin->declaredControls();
+        for ( auto metaObject : metaObjects )
+        {
+            auto function = [ skin, metaObject ]()
+            {
+                if ( skin )
+                    ( void ) skin->skinlet( metaObject );
+            };
+
+            m_data->steps += { Skinlets, function };
+        }
+    }
+
+    if ( tasks & Fonts )
+    {
+        for ( const auto& entry : skin->fonts() )
+        {
+            const auto font = entry.second;
+            m_data->steps += { Fonts, [ font ]() { qskWarmFont( font ); } };
+        }
+    }
+
+    if ( tasks & Graphics )
+    {
+        const auto providers = qskSetup->graphicProviders();
+        for ( auto provider : providers )
+        {
+            QPointer< QskGraphicProvider > p = provider;
+
+            const auto ids = provider->graphicIds();
+            for ( const auto& id : ids )
+            {
+                auto function = [ p, id ]()
+                {
+                    if ( p )
+                        ( void ) p->requestGraphic( id );
+                };
+
+                m_data->steps += { Graphics, function };
+            }
+        }
+    }
+
+    if ( m_data->steps.isEmpty() )
+        Q_EMIT finished();
+    else
+        m_data->timer.start( 0, this );
+}
+
+void QskPrewarmer::stop()
+{
+    m_data->timer.stop();
+}
+
+bool QskPrewarmer::isRunning() const
+{
+    return m_data->timer.isActive();
+}
+
+int QskPrewarmer::warmedCount( Task task ) const
+{
+    return m_data->counts[ qskTaskIndex( task ) ];
+}
+
+qreal QskPrewarmer::busyTime() const
+{
+    return m_data->busyTime / 1e6;
+}
+
+void QskPrewarmer::timerEvent( QTimerEvent* event )
+{
+    if ( event->timerId() != m_data->timer.timerId() )
+    {
+        Inherited::timerEvent( event );
+        return;
+    }
+
+    /*
+        A timer with a zero interval fires, when there are no other
+        pending events. So we are only running, when the event loop
+        is idle - and return to it, when the budget is exhausted.
+     */
+    QElapsedTimer timer;
+    timer.start();
+
+    auto& steps = m_data->steps;
+
+    while ( m_data->stepIndex < steps.count() )
+    {
+        const auto& step = steps[ m_data->stepIndex++ ];
+
+        step.function();
+        m_data->counts[ qskTaskIndex( step.task ) ]++;
+
+        if ( timer.elapsed() >= m_data->budget )
+            break;
+    }
+
+    m_data->busyTime += timer.nsecsElapsed();
+
+    if ( m_data->stepIndex >= steps.count() )
+    {
+        stop();
+        steps.clear();
+
+        Q_EMIT finished();
+    }
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+void QskPrewarmer::debugStatistics( QDebug debug ) const
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "Prewarmed: skinlets: " << warmedCount( Skinlets )
+        << ", graphics: " << warmedCount( Graphics )
+        << ", fonts: " << warmedCount( Fonts )
+        << ", time: " << busyTime() << "ms";
+}
+
+#endif
+
+#include "moc_QskPrewarmer.cpp"
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_PREWARMER_H
+#define QSK_PREWARMER_H
+
+#include "QskGlobal.h"
+
+#include <qobject.h>
+#include <memory>
+
+class QDebug;
+
+/*
+    QskPrewarmer does the work, that would otherwise be done, when
+    a control type is used for the first time: creating the skinlets,
+    loading the graphics of the providers and setting up the fonts
+    of the skin.
+
+    The work is split into small steps, that are processed, when the
+    event loop is idle. Each slice is limited by a time budget, so that
+    the frames in between are not delayed.
+ */
+class QSK_EXPORT QskPrewarmer : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( int budget READ budget WRITE setBudget )
+
+    using Inherited = QObject;
+
+  public:
+    enum Task
+    {
+        Skinlets = 1 << 0,
+        Graphics = 1 << 1,
+        Fonts    = 1 << 2,
+
+        AllTasks = Skinlets | Graphics | Fonts
+    };
+
+    Q_ENUM( Task )
+    Q_DECLARE_FLAGS( Tasks, Task )
+
+    QskPrewarmer( QObject* parent = nullptr );
+    ~QskPrewarmer() override;
+
+    // ms per slice
+    void setBudget( int ms );
+    int budget() const;
+
+    void start( Tasks = AllTasks );
+    void stop();
+
+    bool isRunning() const;
+
+    int warmedCount( Task ) const;
+
+    // ms spent in the slices
+    qreal busyTime() const;
+
+#ifndef QT_NO_DEBUG_STREAM
+    void debugStatistics( QDebug ) const;
+#endif
+
+  Q_SIGNALS:
+    void finished();
+
+  protected:
+    void timerEvent( QTimerEvent* ) override;
+
+  private:
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS( QskPrewarmer::Tasks )
+
+#endif
@@ -282,10 +282,13 @@ void QskProgressBar::setValueInternal( qreal value )
 {
     if ( !qskFuzzyCompare( value, m_data->value ) )
     {
+        const auto oldRect = subControlRect( Bar );
+
         m_data->value = value;
         Q_EMIT valueChanged( value );
 
-        update();
+        // only the bar has been changed
+        updateRect( oldRect | subControlRect( Bar ) );
     }
 }
 
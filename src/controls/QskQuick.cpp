@@ -6,7 +6,9 @@
 #include "QskQuick.h"
 #include "QskControl.h"
 #include "QskFunctions.h"
+#include <qcoreapplication.h>
 #include <qquickitem.h>
+#include <qthread.h>
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qguiapplication_p.h>
@@ -640,3 +642,10 @@ void qskItemUpdateRecursive( QQuickItem* item )
     for ( auto child : children )
         qskItemUpdateRecursive( child );
 }
+
+// internal helper: not part of the public API
+bool qskIsGuiThread()
+{
+    const auto app = QCoreApplication::instance();
+    return app && ( app->thread() == QThread::currentThread() );
+}
@@ -11,8 +11,10 @@
 #include "QskSkin.h"
 #include "QskDirtyItemFilter.h"
 
+#include <qdebug.h>
 #include <qglobalstatic.h>
 #include <qquickwindow.h>
+#include <qthread.h>
 
 #if defined( QT_DEBUG )
 QSK_QT_PRIVATE_BEGIN
@@ -35,6 +37,8 @@ static inline void qskApplyUpdateFlags(
     d->applyUpdateFlags( flags );
 }
 
+extern bool qskIsGuiThread();
+
 static inline void qskFilterWindow( QQuickWindow* window )
 {
     if ( window == nullptr )
@@ -159,7 +163,17 @@ QskQuickItem::QskQuickItem( QskQuickItemPrivate& dd, QQuickItem* parent )
     if ( dd.updateFlags & QskQuickItem::DeferredUpdate )
         qskFilterWindow( window() );
 
-    qskRegistry->insert( this );
+    /*
+        Items being constructed in a worker thread ( see QskItemBuilder )
+        are registered, when being handed over to the GUI thread.
+     */
+    if ( qskIsGuiThread() )
+        qskRegistry->insert( this );
+}
+
+void qskRegisterItem( QskQuickItem* item )
+{
+    qskRegistry->insert( item );
 }
 
 QskQuickItem::~QskQuickItem()
@@ -171,7 +185,7 @@ QskQuickItem::~QskQuickItem()
      */
     d_func()->componentComplete = false;
 
-    if ( qskRegistry )
+    if ( qskRegistry && qskIsGuiThread() )
         qskRegistry->remove( this );
 
 #if QT_VERSION < QT_VERSION_CHECK( 5, 10, 0 )
@@ -414,6 +428,34 @@ void QskQuickItem::resetLayoutMirroring()
     }
 }
 
+void QskQuickItem::setCulled( bool on )
+{
+    Q_D( QskQuickItem );
+
+    if ( on == d->viewportCulled )
+        return;
+
+    d->viewportCulled = on;
+
+    if ( on )
+    {
+        qskFilterWindow( window() );
+    }
+    else if ( isVisible() )
+    {
+        if ( d->blockedPolish )
+            polish();
+
+        if ( d->dirtyAttributes && ( d->flags & QQuickItem::ItemHasContents ) )
+            update();
+    }
+}
+
+bool QskQuickItem::isCulled() const
+{
+    return d_func()->viewportCulled;
+}
+
 bool QskQuickItem::isPolishScheduled() const
 {
     return d_func()->polishScheduled;
@@ -554,6 +596,7 @@ void QskQuickItem::applyUpdateFlag( UpdateFlag flag, bool on )
 
             break;
         }
+        case QskQuickItem::PreferGeometryForGraphics:
         case QskQuickItem::DebugForceBackground:
         {
             // no need to mark it dirty
@@ -570,6 +613,8 @@ void QskQuickItem::resetImplicitSize()
 {
     Q_D( QskQuickItem );
 
+    d->invalidateImplicitSizeHints();
+
     if ( d->updateFlags & QskQuickItem::DeferredLayout )
     {
         d->blockedImplicitSize = true;
@@ -713,9 +758,19 @@ void QskQuickItem::itemChange( QQuickItem::ItemChange change,
         {
             if ( changeData.window )
             {
+                if ( changeData.window->thread() != QThread::currentThread() )
+                {
+                    qWarning() << "QskQuickItem: inserting an item into a window"
+                        << "from a different thread" << this;
+                }
+
                 Q_D( const QskQuickItem );
-                if ( d->updateFlags & QskQuickItem::DeferredUpdate )
+
+                if ( ( d->updateFlags & QskQuickItem::DeferredUpdate )
+                    || d->viewportCulled )
+                {
                     qskFilterWindow( changeData.window );
+                }
             }
 
 #if 1
@@ -758,6 +813,9 @@ void QskQuickItem::itemChange( QQuickItem::ItemChange change,
             }
 #endif
 
+            if ( oldWindow )
+                d_func()->addGeometryDamage( oldWindow );
+
             QskWindowChangeEvent event( oldWindow, changeData.window );
             QCoreApplication::sendEvent( this, &event );
 
@@ -800,6 +858,8 @@ void QskQuickItem::itemChange( QQuickItem::ItemChange change,
                 d->initiallyPainted = false;
             }
 
+            d->addGeometryDamage( window() );
+
             if ( parentItem() && parentItem()->isVisible() )
             {
                 /*
@@ -858,10 +918,14 @@ void QskQuickItem::geometryChange(
     Inherited::geometryChange( newGeometry, oldGeometry );
 #endif
 
-    Q_D( const QskQuickItem );
-    if ( !d->polishScheduled && d->polishOnResize )
+    Q_D( QskQuickItem );
+
+    if ( newGeometry.size() != oldGeometry.size() )
     {
-        if ( newGeometry.size() != oldGeometry.size() )
+        // the paint node will be updated for the new size
+        d->dirtyRect = rect();
+
+        if ( !d->polishScheduled && d->polishOnResize )
             polish();
     }
 
@@ -892,6 +956,12 @@ void QskQuickItem::updatePolish()
 {
     Q_D( QskQuickItem );
 
+    if ( d->viewportCulled )
+    {
+        d->blockedPolish = true;
+        return;
+    }
+
     if ( d->updateFlags & QskQuickItem::DeferredPolish )
     {
         if ( !isVisible() )
@@ -924,6 +994,28 @@ void QskQuickItem::updateItemPolish()
 {
 }
 
+void QskQuickItem::updateRect( const QRectF& rect )
+{
+    Q_D( QskQuickItem );
+
+    const auto r = rect.intersected( this->rect() );
+    if ( r.isEmpty() )
+        return;
+
+    if ( ( d->dirtyAttributes & QQuickItemPrivate::Content ) && d->dirtyRect.isNull() )
+    {
+        // an update of the complete item is already pending
+        return;
+    }
+
+    if ( d->dirtyRect.isNull() )
+        d->dirtyRect = r;
+    else
+        d->dirtyRect |= r;
+
+    update();
+}
+
 QSGNode* QskQuickItem::updatePaintNode( QSGNode* node, UpdatePaintNodeData* data )
 {
     Q_UNUSED( data );
@@ -931,7 +1023,9 @@ QSGNode* QskQuickItem::updatePaintNode( QSGNode* node, UpdatePaintNodeData* data
     Q_D( QskQuickItem );
 
     Q_ASSERT( isVisible() || !( d->updateFlags & QskQuickItem::DeferredUpdate ) );
+    Q_ASSERT( !d->viewportCulled );
 
+    d->addContentDamage();
     d->initiallyPainted = true;
 
     if ( d->clearPreviousNodes )
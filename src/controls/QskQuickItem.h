@@ -46,6 +46,7 @@ class QSK_EXPORT QskQuickItem : public QQuickItem
         CleanupOnVisibility     =  1 << 3,
 
         PreferRasterForTextures =  1 << 4,
+        PreferGeometryForGraphics = 1 << 5,
 
         DebugForceBackground    =  1 << 7
     };
@@ -95,6 +96,23 @@ class QSK_EXPORT QskQuickItem : public QQuickItem
     void componentComplete() override;
     void releaseResources() override;
 
+    /*
+        Like update(), but indicating, that only the part of the item
+        inside of rect has changed. The rectangles of all calls before
+        the next frame are united: see QskWindow::setDamageTracking.
+        A complete update() after updateRect() in the same frame is not
+        detected and only the rectangles are reported as damaged.
+     */
+    void updateRect( const QRectF& rect );
+
+    /*
+        Culled items are outside of the visible area of a scroll area
+        and defer polishing and updating their nodes until being
+        unculled again: see QskScrollArea::setViewportCulling
+     */
+    void setCulled( bool );
+    bool isCulled() const;
+
     bool isPolishScheduled() const;
     bool isUpdateNodeScheduled() const;
     bool isInitiallyPainted() const;
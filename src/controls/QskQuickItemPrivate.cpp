@@ -5,6 +5,8 @@
 
 #include "QskQuickItemPrivate.h"
 #include "QskSetup.h"
+#include "QskWindow.h"
+#include "QskWindowPrivate.h"
 
 static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 {
@@ -12,6 +14,42 @@ static inline void qskSendEventTo( QObject* object, QEvent::Type type )
     QCoreApplication::sendEvent( object, &event );
 }
 
+static inline QskWindowPrivate* qskDamageTracker( QQuickWindow* window )
+{
+    if ( auto w = qobject_cast< QskWindow* >( window ) )
+    {
+        auto d = QskWindowPrivate::get( w );
+        if ( d->damageTracking )
+            return d;
+    }
+
+    return nullptr;
+}
+
+static QRectF qskSceneRect( const QQuickItem* item )
+{
+    // the item including its children
+
+    if ( !item->isVisible() )
+        return QRectF();
+
+    auto rect = item->mapRectToScene(
+        QRectF( 0.0, 0.0, item->width(), item->height() ) );
+
+    if ( !item->clip() )
+    {
+        const auto children = item->childItems();
+        for ( const auto child : children )
+        {
+            const auto r = qskSceneRect( child );
+            if ( !r.isEmpty() )
+                rect |= r;
+        }
+    }
+
+    return rect;
+}
+
 QskQuickItemPrivate::QskQuickItemPrivate()
     : updateFlags( qskSetup->itemUpdateFlags() )
     , updateFlagsMask( 0 )
@@ -20,6 +58,7 @@ QskQuickItemPrivate::QskQuickItemPrivate()
     , blockedImplicitSize( true )
     , clearPreviousNodes( false )
     , initiallyPainted( false )
+    , viewportCulled( false )
 {
     if ( updateFlags & QskQuickItem::DeferredLayout )
     {
@@ -89,6 +128,10 @@ void QskQuickItemPrivate::implicitSizeChanged()
     layoutConstraintChanged();
 }
 
+void QskQuickItemPrivate::invalidateImplicitSizeHints()
+{
+}
+
 qreal QskQuickItemPrivate::getImplicitWidth() const
 {
     if ( blockedImplicitSize )
@@ -239,4 +282,63 @@ QSGTransformNode* QskQuickItemPrivate::createTransformNode()
 void QskQuickItemPrivate::transformChanged()
 {
     Inherited::transformChanged();
+
+    // position, size or transformation
+    addGeometryDamage( window );
+}
+
+void QskQuickItemPrivate::addContentDamage()
+{
+    // called from updatePaintNode
+
+    Q_Q( QskQuickItem );
+
+    if ( auto tracker = qskDamageTracker( window ) )
+    {
+        const auto r = dirtyRect.isNull() ? q->rect() : dirtyRect;
+        tracker->addDamage( q->mapRectToScene( r ) );
+
+        if ( damagedRect.isNull() )
+            damagedRect = qskSceneRect( q );
+    }
+
+    dirtyRect = QRectF();
+}
+
+void QskQuickItemPrivate::addGeometryDamage( QQuickWindow* window )
+{
+    /*
+        The item has been moved, resized, hidden or removed from window:
+        both, the area it was covering before and the one it is covering
+        now, have been damaged.
+     */
+    auto tracker = qskDamageTracker( window );
+    if ( tracker == nullptr )
+        return;
+
+    Q_Q( QskQuickItem );
+
+    if ( !damagedRect.isEmpty() )
+        tracker->addDamage( damagedRect );
+
+    damagedRect = ( window == this->window ) ? qskSceneRect( q ) : QRectF();
+
+    if ( damagedRect.isEmpty() )
+        return;
+
+    tracker->addDamage( damagedRect );
+
+    /*
+        The areas of the ancestors have to include the new position,
+        so that it is covered, when they are moved later
+     */
+    for ( auto item = q->parentItem(); item; item = item->parentItem() )
+    {
+        if ( auto qskItem = qobject_cast< QskQuickItem* >( item ) )
+        {
+            auto d = static_cast< QskQuickItemPrivate* >( QQuickItemPrivate::get( qskItem ) );
+            if ( !d->damagedRect.isNull() )
+                d->damagedRect |= damagedRect;
+        }
+    }
 }
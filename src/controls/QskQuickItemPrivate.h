@@ -24,9 +24,14 @@ class QskQuickItemPrivate : public QQuickItemPrivate
   public:
     void applyUpdateFlags( QskQuickItem::UpdateFlags );
 
+    // damage tracking: see QskWindow::setDamageTracking
+    void addContentDamage();
+    void addGeometryDamage( QQuickWindow* );
+
   protected:
     virtual void layoutConstraintChanged();
     virtual void implicitSizeChanged();
+    virtual void invalidateImplicitSizeHints();
 
   private:
     QSGTransformNode* createTransformNode() override;
@@ -52,6 +57,12 @@ class QskQuickItemPrivate : public QQuickItemPrivate
     quint8 updateFlags;
     quint8 updateFlagsMask;
 
+    // the part, that needs to be updated - null, when being unknown
+    QRectF dirtyRect;
+
+    // the scene area of the item and its children, when being damaged last
+    QRectF damagedRect;
+
     bool polishOnResize : 1;
 
     bool blockedPolish : 1;
@@ -59,6 +70,7 @@ class QskQuickItemPrivate : public QQuickItemPrivate
     bool clearPreviousNodes : 1;
 
     bool initiallyPainted : 1;
+    bool viewportCulled : 1;
 };
 
 #endif
@@ -0,0 +1,163 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskSceneStatistics.h"
+#include "QskControl.h"
+#include "QskSGNode.h"
+#include "QskTextureNode.h"
+
+#include <qquickwindow.h>
+#include <qsgimagenode.h>
+#include <qsgnode.h>
+#include <qsgtexturematerial.h>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickitem_p.h>
+QSK_QT_PRIVATE_END
+
+static inline bool qskIsTextured( const QSGGeometryNode* node )
+{
+    if ( auto imageNode = dynamic_cast< const QSGImageNode* >( node ) )
+        return imageNode->texture() != nullptr;
+
+    if ( auto textureNode = dynamic_cast< const QskTextureNode* >( node ) )
+        return !textureNode->isNull();
+
+    if ( auto material = dynamic_cast< const QSGOpaqueTextureMaterial* >( node->material() ) )
+        return material->texture() != nullptr;
+
+    return false;
+}
+
+static void qskCountNodes( const QSGNode* node, QskSceneStatistics::Counters& counters )
+{
+    counters.nodes++;
+
+    if ( node->type() == QSGNode::GeometryNodeType )
+    {
+        auto geometryNode = static_cast< const QSGGeometryNode* >( node );
+
+        counters.geometryNodes++;
+
+        if ( auto geometry = geometryNode->geometry() )
+        {
+            counters.vertices += geometry->vertexCount();
+            counters.indices += geometry->indexCount();
+        }
+
+        if ( qskIsTextured( geometryNode ) )
+            counters.textures++;
+    }
+
+    for ( auto child = node->firstChild(); child; child = child->nextSibling() )
+        qskCountNodes( child, counters );
+}
+
+static void qskCollectControls( const QQuickItem* item, QskSceneStatistics& statistics )
+{
+    if ( auto control = qobject_cast< const QskControl* >( item ) )
+    {
+        if ( auto paintNode = QQuickItemPrivate::get( control )->paintNode )
+        {
+            QskSceneStatistics::Control entry;
+            entry.control = control;
+            entry.className = QString::fromLatin1( control->metaObject()->className() );
+            entry.objectName = control->objectName();
+
+            for ( auto node = paintNode->firstChild(); node; node = node->nextSibling() )
+            {
+                QskSceneStatistics::NodeRole nodeRole;
+                nodeRole.role = QskSGNode::nodeRole( node );
+
+                qskCountNodes( node, nodeRole.counters );
+
+                entry.counters += nodeRole.counters;
+                entry.nodeRoles += nodeRole;
+            }
+
+            statistics.total += entry.counters;
+            statistics.controls += entry;
+        }
+    }
+
+    const auto children = item->childItems();
+    for ( auto child : children )
+        qskCollectControls( child, statistics );
+}
+
+QskSceneStatistics::Counters& QskSceneStatistics::Counters::operator+=(
+    const Counters& other ) noexcept
+{
+    nodes += other.nodes;
+    geometryNodes += other.geometryNodes;
+    vertices += other.vertices;
+    indices += other.indices;
+    textures += other.textures;
+
+    return *this;
+}
+
+bool QskSceneStatistics::Counters::exceeds( const Counters& limits ) const noexcept
+{
+    auto exceeds = []( int value, int limit ) { return ( limit > 0 ) && ( value > limit ); };
+
+    return exceeds( nodes, limits.nodes )
+        || exceeds( geometryNodes, limits.geometryNodes )
+        || exceeds( vertices, limits.vertices )
+        || exceeds( indices, limits.indices )
+        || exceeds( textures, limits.textures );
+}
+
+QskSceneStatistics QskSceneStatistics::collect( const QQuickWindow* window )
+{
+    QskSceneStatistics statistics;
+
+    if ( window && window->contentItem() )
+        qskCollectControls( window->contentItem(), statistics );
+
+    return statistics;
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+#include <qdebug.h>
+
+QDebug operator<<( QDebug debug, const QskSceneStatistics::Counters& counters )
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "Nodes: " << counters.nodes
+        << ", Geometries: " << counters.geometryNodes
+        << ", Vertices: " << counters.vertices
+        << ", Indices: " << counters.indices
+        << ", Textures: " << counters.textures;
+
+    return debug;
+}
+
+QDebug operator<<( QDebug debug, const QskSceneStatistics& statistics )
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "Scene: " << statistics.total;
+
+    for ( const auto& control : statistics.controls )
+    {
+        debug << "\n  " << control.className;
+        if ( !control.objectName.isEmpty() )
+            debug << " " << control.objectName;
+
+        debug << ": " << control.counters;
+
+        for ( const auto& nodeRole : control.nodeRoles )
+            debug << "\n    Role " << int( nodeRole.role ) << ": " << nodeRole.counters;
+    }
+
+    return debug;
+}
+
+#endif
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_SCENE_STATISTICS_H
+#define QSK_SCENE_STATISTICS_H
+
+#include "QskGlobal.h"
+
+#include <qmetatype.h>
+#include <qstring.h>
+#include <qvector.h>
+
+class QskControl;
+class QQuickWindow;
+class QDebug;
+
+class QSK_EXPORT QskSceneStatistics
+{
+  public:
+    class Counters
+    {
+      public:
+        Counters& operator+=( const Counters& ) noexcept;
+
+        // true, when one of the counters exceeds a limit > 0
+        bool exceeds( const Counters& limits ) const noexcept;
+
+        int nodes = 0;
+        int geometryNodes = 0;
+        int vertices = 0;
+        int indices = 0;
+        int textures = 0;
+    };
+
+    class NodeRole
+    {
+      public:
+        /*
+            The node roles are specific for the skinlet of the
+            control, the roles of QskSGNode::Role are common for all.
+         */
+        quint8 role = 0xff;
+        Counters counters;
+    };
+
+    class Control
+    {
+      public:
+        // only for identifying the control - it might be deleted meanwhile
+        const QskControl* control = nullptr;
+
+        QString className;
+        QString objectName;
+
+        Counters counters;
+        QVector< NodeRole > nodeRoles;
+    };
+
+    /*
+        Walks the paint nodes of all QskControls of the window.
+        Has to be called on the scene graph thread, while the
+        GUI thread is blocked.
+     */
+    static QskSceneStatistics collect( const QQuickWindow* );
+
+    QVector< Control > controls;
+
+    Counters total;
+};
+
+#ifndef QT_NO_DEBUG_STREAM
+
+QSK_EXPORT QDebug operator<<( QDebug, const QskSceneStatistics::Counters& );
+QSK_EXPORT QDebug operator<<( QDebug, const QskSceneStatistics& );
+
+#endif
+
+Q_DECLARE_METATYPE( QskSceneStatistics )
+
+#endif
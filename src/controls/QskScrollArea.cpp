@@ -10,6 +10,8 @@
 #include "QskBoxBorderMetrics.h"
 #include "QskSGNode.h"
 
+#include <qset.h>
+
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickclipnode_p.h>
 #include <private/qquickitem_p.h>
@@ -96,6 +98,16 @@ static inline QSizeF qskScrolledItemSize( const QskScrollView* scrollView,
     return itemSize;
 }
 
+static void qskCullTree( QQuickItem* item, bool on )
+{
+    if ( auto qskItem = qobject_cast< QskQuickItem* >( item ) )
+        qskItem->setCulled( on );
+
+    const auto& children = QQuickItemPrivate::get( item )->childItems;
+    for ( auto child : children )
+        qskCullTree( child, on );
+}
+
 namespace
 {
     class ViewportClipNode final : public QQuickDefaultClipNode
@@ -387,11 +399,166 @@ namespace
     }
 }
 
+namespace
+{
+    /*
+        The culling state is decided for the children of the scrolled item
+        and applied to their subtrees, when it has changed. Children are
+        checked, when the viewport has changed or when being moved/resized.
+     */
+    class CullingListener final : public QQuickItemChangeListener
+    {
+      public:
+        ~CullingListener()
+        {
+            reset();
+        }
+
+        // viewRect is in coordinates of the item
+        void update( QQuickItem* item, const QRectF& viewRect )
+        {
+            if ( item != m_item )
+            {
+                reset();
+
+                m_item = item;
+                m_viewRect = viewRect;
+
+                enableListener( m_item, QQuickItemPrivate::Children
+                    | QQuickItemPrivate::Destroyed, true );
+
+                const auto& children = QQuickItemPrivate::get( m_item )->childItems;
+                for ( auto child : children )
+                {
+                    enableListener( child, QQuickItemPrivate::Geometry, true );
+                    updateChild( child );
+                }
+            }
+            else if ( viewRect != m_viewRect )
+            {
+                m_viewRect = viewRect;
+
+                const auto& children = QQuickItemPrivate::get( m_item )->childItems;
+                for ( auto child : children )
+                    updateChild( child );
+            }
+        }
+
+        // unculling all children and detaching from the item
+        void reset()
+        {
+            if ( m_item == nullptr )
+                return;
+
+            enableListener( m_item, QQuickItemPrivate::Children
+                | QQuickItemPrivate::Destroyed, false );
+
+            const auto& children = QQuickItemPrivate::get( m_item )->childItems;
+            for ( auto child : children )
+                enableListener( child, QQuickItemPrivate::Geometry, false );
+
+            for ( auto child : qskAsConst( m_culledChildren ) )
+                qskCullTree( child, false );
+
+            m_culledChildren.clear();
+            m_item = nullptr;
+        }
+
+        int culledCount() const
+        {
+            return int( m_culledChildren.count() );
+        }
+
+        int activeCount() const
+        {
+            if ( m_item == nullptr )
+                return 0;
+
+            const auto& children = QQuickItemPrivate::get( m_item )->childItems;
+            return int( children.count() - m_culledChildren.count() );
+        }
+
+      protected:
+        void itemChildAdded( QQuickItem*, QQuickItem* child ) override
+        {
+            enableListener( child, QQuickItemPrivate::Geometry, true );
+            updateChild( child );
+        }
+
+        void itemChildRemoved( QQuickItem*, QQuickItem* child ) override
+        {
+            enableListener( child, QQuickItemPrivate::Geometry, false );
+
+            if ( m_culledChildren.remove( child ) )
+                qskCullTree( child, false );
+        }
+
+        void itemDestroyed( QQuickItem* item ) override
+        {
+            if ( item == m_item )
+            {
+                m_item = nullptr;
+                m_culledChildren.clear();
+            }
+        }
+
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+        void itemGeometryChanged( QQuickItem* item,
+            QQuickGeometryChange, const QRectF& ) override
+        {
+            updateChild( item );
+        }
+#else
+        void itemGeometryChanged( QQuickItem* item,
+            const QRectF&, const QRectF& ) override
+        {
+            updateChild( item );
+        }
+#endif
+
+      private:
+        void enableListener( QQuickItem* item,
+            QQuickItemPrivate::ChangeTypes types, bool on )
+        {
+            auto p = QQuickItemPrivate::get( item );
+            if ( on )
+                p->addItemChangeListener( this, types );
+            else
+                p->removeItemChangeListener( this, types );
+        }
+
+        void updateChild( QQuickItem* child )
+        {
+            if ( child->parentItem() != m_item )
+                return;
+
+            const QRectF childRect( child->position(), child->size() );
+            const bool on = !childRect.intersects( m_viewRect );
+
+            if ( on != m_culledChildren.contains( child ) )
+            {
+                if ( on )
+                    m_culledChildren += child;
+                else
+                    m_culledChildren.remove( child );
+
+                qskCullTree( child, on );
+            }
+        }
+
+        QQuickItem* m_item = nullptr;
+        QRectF m_viewRect;
+
+        QSet< QQuickItem* > m_culledChildren;
+    };
+}
+
 class QskScrollArea::PrivateData
 {
   public:
     PrivateData()
         : isItemResizable( true )
+        , viewportCulling( false )
     {
     }
 
@@ -411,7 +578,11 @@ class QskScrollArea::PrivateData
 
     ClipItem* clipItem = nullptr;
 
+    qreal cullingMargin = 100.0;
+    CullingListener cullingListener;
+
     bool isItemResizable : 1;
+    bool viewportCulling : 1;
 };
 
 /*
@@ -440,6 +611,7 @@ QskScrollArea::QskScrollArea( QQuickItem* parentItem )
 
 QskScrollArea::~QskScrollArea()
 {
+    m_data->cullingListener.reset();
     delete m_data->clipItem;
 }
 
@@ -519,6 +691,8 @@ void QskScrollArea::setScrolledItem( QQuickItem* item )
 
     if ( oldItem )
     {
+        m_data->cullingListener.reset();
+
         if ( oldItem->parent() == this )
             delete oldItem;
         else
@@ -532,6 +706,9 @@ void QskScrollArea::setScrolledItem( QQuickItem* item )
             item->setParent( m_data->clipItem );
     }
 
+    if ( m_data->viewportCulling )
+        updateCulling();
+
     polish();
     Q_EMIT scrolledItemChanged();
 }
@@ -541,12 +718,77 @@ QQuickItem* QskScrollArea::scrolledItem() const
     return m_data->clipItem->scrolledItem();
 }
 
+void QskScrollArea::setViewportCulling( bool on )
+{
+    if ( on == m_data->viewportCulling )
+        return;
+
+    m_data->viewportCulling = on;
+
+    if ( on )
+        updateCulling();
+    else
+        m_data->cullingListener.reset();
+}
+
+bool QskScrollArea::hasViewportCulling() const
+{
+    return m_data->viewportCulling;
+}
+
+void QskScrollArea::setCullingMargin( qreal margin )
+{
+    margin = qMax( margin, 0.0 );
+
+    if ( margin != m_data->cullingMargin )
+    {
+        m_data->cullingMargin = margin;
+
+        if ( m_data->viewportCulling )
+            updateCulling();
+    }
+}
+
+qreal QskScrollArea::cullingMargin() const
+{
+    return m_data->cullingMargin;
+}
+
+int QskScrollArea::culledItemCount() const
+{
+    return m_data->cullingListener.culledCount();
+}
+
+int QskScrollArea::activeItemCount() const
+{
+    return m_data->cullingListener.activeCount();
+}
+
+void QskScrollArea::updateCulling()
+{
+    auto item = scrolledItem();
+
+    if ( item && m_data->viewportCulling )
+    {
+        const auto m = m_data->cullingMargin;
+
+        // the clip item is always at the origin of the scroll area
+        auto viewRect = viewContentsRect().adjusted( -m, -m, m, m );
+        viewRect.translate( -item->position() );
+
+        m_data->cullingListener.update( item, viewRect );
+    }
+}
+
 void QskScrollArea::translateItem()
 {
     if ( auto item = m_data->clipItem->scrolledItem() )
     {
         const QPointF pos = viewContentsRect().topLeft() - scrollPos();
         item->setPosition( pos );
+
+        if ( m_data->viewportCulling )
+            updateCulling();
     }
 }
 
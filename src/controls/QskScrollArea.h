@@ -30,6 +30,23 @@ class QSK_EXPORT QskScrollArea : public QskScrollView
     void setItemResizable( bool on );
     bool isItemResizable() const;
 
+    /*
+        When culling is enabled, the children of the scrolled item, that
+        are outside of the viewport - expanded by the culling margin - are culled
+        with all QskQuickItems below, deferring polishing and updating their nodes
+        until coming close to the viewport. Transformations ( scaling/rotation )
+        of the items are ignored.
+     */
+    void setViewportCulling( bool on );
+    bool hasViewportCulling() const;
+
+    void setCullingMargin( qreal );
+    qreal cullingMargin() const;
+
+    // numbers of culled/active children of the scrolled item
+    int culledItemCount() const;
+    int activeItemCount() const;
+
   Q_SIGNALS:
     void scrolledItemChanged();
     void itemResizableChanged( bool );
@@ -40,6 +57,7 @@ class QSK_EXPORT QskScrollArea : public QskScrollView
   private:
     void translateItem();
     void adjustItem();
+    void updateCulling();
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
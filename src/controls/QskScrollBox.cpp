@@ -11,10 +11,15 @@
 #include "QskPanGestureRecognizer.h"
 #include "QskQuick.h"
 
+#include <qmath.h>
+#include <qscreen.h>
+
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickwindow_p.h>
 QSK_QT_PRIVATE_END
 
+#include <limits>
+
 namespace
 {
     class FlickAnimator final : public QskFlickAnimator
@@ -42,6 +47,163 @@ namespace
         QskScrollBox* m_scrollBox;
     };
 
+    class PanAnimator final : public QskAnimator
+    {
+        /*
+            Instead of scrolling with each incoming mouse event the scroll
+            position is updated once per frame - with the position
+            of the finger being extrapolated to the time, when the frame
+            will be displayed.
+         */
+
+      public:
+        PanAnimator()
+        {
+            // running as long as the finger is down
+            setDuration( std::numeric_limits< int >::max() );
+        }
+
+        void setScrollBox( QskScrollBox* scrollBox )
+        {
+            m_scrollBox = scrollBox;
+        }
+
+        void begin( const QPointF& pos )
+        {
+            stop();
+            setWindow( m_scrollBox->window() );
+
+            m_pos = m_appliedPos = pos;
+            m_velocity = QPointF();
+
+            m_eventTime = m_pendingEventTime = m_displayedEventTime = -1;
+
+            m_latency = 0.0;
+            m_latencyCount = 0;
+
+            if ( window() == nullptr )
+                return;
+
+            start();
+
+            QObject::disconnect( m_swapConnection );
+            m_swapConnection = QObject::connect( window(), &QQuickWindow::frameSwapped,
+                m_scrollBox, [ this ] { updateLatency(); } );
+        }
+
+        void pan( const QPointF& pos, qreal velocity, qreal degrees )
+        {
+            if ( !isRunning() )
+            {
+                // no window: scrolling without prediction
+                m_scrollBox->setScrollPos( m_scrollBox->scrollPos() - ( pos - m_pos ) );
+                m_pos = m_appliedPos = pos;
+
+                return;
+            }
+
+            m_pos = pos;
+            m_eventTime = elapsed();
+
+            const qreal radians = qDegreesToRadians( degrees );
+            m_velocity = QPointF( qCos( radians ), -qSin( radians ) ) * velocity;
+        }
+
+        void end()
+        {
+            if ( isRunning() )
+            {
+                // getting rid of the extrapolated offset
+                scrollTo( m_pos );
+                stop();
+            }
+
+            QObject::disconnect( m_swapConnection );
+        }
+
+        // average time between receiving a pan event and displaying it ( ms )
+        qreal latency() const
+        {
+            return m_latencyCount ? m_latency / m_latencyCount : 0.0;
+        }
+
+      protected:
+        void advance( qreal ) override
+        {
+            QPointF pos = m_pos;
+
+            const auto age = elapsed() - m_eventTime;
+
+            if ( age <= MaxEventAge )
+            {
+                /*
+                    The frame, that is prepared now, will be displayed with
+                    the next vsync. In case of the finger resting we
+                    stop extrapolating.
+                 */
+                const auto lookAhead = qMin( age + frameInterval(), qreal( MaxLookAhead ) );
+                pos += m_velocity * ( lookAhead / 1000.0 );
+            }
+
+            if ( m_eventTime > m_displayedEventTime )
+                m_pendingEventTime = m_eventTime;
+
+            scrollTo( pos );
+        }
+
+      private:
+        inline void scrollTo( const QPointF& pos )
+        {
+            if ( pos != m_appliedPos )
+            {
+                m_scrollBox->setScrollPos( m_scrollBox->scrollPos() - ( pos - m_appliedPos ) );
+                m_appliedPos = pos;
+            }
+        }
+
+        inline qreal frameInterval() const
+        {
+            qreal rate = 60.0;
+
+            if ( auto screen = window()->screen() )
+            {
+                if ( screen->refreshRate() > 0.0 )
+                    rate = screen->refreshRate();
+            }
+
+            return 1000.0 / rate;
+        }
+
+        void updateLatency()
+        {
+            if ( isRunning() && m_pendingEventTime > m_displayedEventTime )
+            {
+                m_latency += elapsed() - m_pendingEventTime;
+                m_latencyCount++;
+
+                m_displayedEventTime = m_pendingEventTime;
+            }
+        }
+
+        enum { MaxEventAge = 50 }; // ms
+        enum { MaxLookAhead = 40 }; // ms
+
+        QskScrollBox* m_scrollBox = nullptr;
+
+        QPointF m_pos;
+        QPointF m_appliedPos;
+        QPointF m_velocity;
+
+        qint64 m_eventTime = -1;
+        qint64 m_pendingEventTime = -1;
+        qint64 m_displayedEventTime = -1;
+
+        qreal m_latency = 0.0;
+        int m_latencyCount = 0;
+
+        QMetaObject::Connection m_swapConnection;
+    };
+
     class ScrollAnimator final : public QskAnimator
     {
       public:
@@ -102,6 +264,7 @@ class QskScrollBox::PrivateData
   public:
     PrivateData()
         : autoScrollFocusItem( true )
+        , panPrediction( false )
     {
     }
 
@@ -113,10 +276,12 @@ class QskScrollBox::PrivateData
 
     FlickAnimator flicker;
     ScrollAnimator scroller;
+    PanAnimator panner;
 
     const qreal viewportPadding = 10;
 
     bool autoScrollFocusItem : 1;
+    bool panPrediction : 1;
 };
 
 QskScrollBox::QskScrollBox( QQuickItem* parent )
@@ -125,6 +290,7 @@ QskScrollBox::QskScrollBox( QQuickItem* parent )
 {
     m_data->flicker.setScrollBox( this );
     m_data->scroller.setScrollBox( this );
+    m_data->panner.setScrollBox( this );
 
     m_data->panRecognizer.setWatchedItem( this );
     m_data->panRecognizer.setOrientations( Qt::Horizontal | Qt::Vertical );
@@ -190,6 +356,25 @@ int QskScrollBox::flickRecognizerTimeout() const
     return m_data->panRecognizerTimeout;
 }
 
+void QskScrollBox::setPanPrediction( bool on )
+{
+    if ( on != m_data->panPrediction )
+    {
+        m_data->panner.end();
+        m_data->panPrediction = on;
+    }
+}
+
+bool QskScrollBox::panPrediction() const
+{
+    return m_data->panPrediction;
+}
+
+qreal QskScrollBox::panLatency() const
+{
+    return m_data->panner.latency();
+}
+
 void QskScrollBox::setFlickableOrientations( Qt::Orientations orientations )
 {
     if ( m_data->panRecognizer.orientations() != orientations )
@@ -367,19 +552,38 @@ void QskScrollBox::gestureEvent( QskGestureEvent* event )
 
         switch ( gesture->state() )
         {
+            case QskGesture::Started:
+            {
+                if ( m_data->panPrediction )
+                    m_data->panner.begin( gesture->position() );
+
+                break;
+            }
             case QskGesture::Updated:
             {
-                setScrollPos( scrollPos() - gesture->delta() );
+                if ( m_data->panPrediction )
+                {
+                    m_data->panner.pan( gesture->position(),
+                        gesture->velocity(), gesture->angle() );
+                }
+                else
+                {
+                    setScrollPos( scrollPos() - gesture->delta() );
+                }
                 break;
             }
             case QskGesture::Finished:
             {
+                m_data->panner.end();
+
                 m_data->flicker.setWindow( window() );
                 m_data->flicker.accelerate( gesture->angle(), gesture->velocity() );
                 break;
             }
             case QskGesture::Canceled:
             {
+                m_data->panner.end();
+
                 // what to do here: maybe going back to the origin of the gesture ??
                 break;
             }
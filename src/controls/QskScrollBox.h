@@ -36,6 +36,18 @@ class QSK_EXPORT QskScrollBox : public QskControl
     int flickRecognizerTimeout() const;
     void setFlickRecognizerTimeout( int timeout );
 
+    /*
+        With pan prediction the scroll position is updated once per frame
+        extrapolating the position of the finger to the time, when the frame
+        will be displayed. This compensates the latency and avoids uneven
+        scrolling, when the events are not in sync with the display.
+     */
+    void setPanPrediction( bool );
+    bool panPrediction() const;
+
+    // average latency ( ms ) between pan events and displaying them
+    qreal panLatency() const;
+
     virtual QskAnimationHint flickHint() const = 0;
 
     QPointF scrollPos() const;
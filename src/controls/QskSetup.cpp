@@ -14,6 +14,7 @@
 
 #include <qguiapplication.h>
 #include <qpointer.h>
+#include <qreadwritelock.h>
 #include <qstylehints.h>
 
 QskSetup* QskSetup::s_instance = nullptr;
@@ -38,6 +39,9 @@ static inline const QskQuickItem::UpdateFlags qskEnvironmentUpdateFlags()
     if ( qskHasEnvironment( "QSK_PREFER_RASTER" ) )
         flags |= QskQuickItem::PreferRasterForTextures;
 
+    if ( qskHasEnvironment( "QSK_PREFER_GEOMETRY" ) )
+        flags |= QskQuickItem::PreferGeometryForGraphics;
+
     if ( qskHasEnvironment( "QSK_FORCE_BACKGROUND" ) )
         flags |= QskQuickItem::DebugForceBackground;
 
@@ -111,6 +115,16 @@ namespace
     };
 }
 
+/*
+    Held for reading by QskItemBuilder, while building in a worker
+    thread, so that the skin is not replaced/deleted in the meantime
+ */
+QReadWriteLock* qskSkinLock()
+{
+    static QReadWriteLock lock;
+    return &lock;
+}
+
 class QskSetup::PrivateData
 {
   public:
@@ -204,15 +218,22 @@ QskSkin* QskSetup::setSkin( const QString& skinName )
 
     const QskSkin* oldSkin = m_data->skin;
 
-    m_data->skin = skin;
-    m_data->skinName = skinName;
+    {
+        QWriteLocker locker( qskSkinLock() );
+
+        m_data->skin = skin;
+        m_data->skinName = skinName;
+    }
 
     if ( oldSkin )
     {
         Q_EMIT skinChanged( skin );
 
         if ( oldSkin->parent() == this )
+        {
+            QWriteLocker locker( qskSkinLock() );
             delete oldSkin;
+        }
     }
 
     return m_data->skin;
@@ -254,6 +275,23 @@ QskGraphicProvider* QskSetup::graphicProvider( const QString& providerId ) const
     return m_data->graphicProviders.provider( providerId );
 }
 
+QList< QskGraphicProvider* > QskSetup::graphicProviders() const
+{
+    QList< QskGraphicProvider* > providers;
+
+    if ( m_data->skin )
+        providers = m_data->skin->graphicProviders();
+
+    const auto setupProviders = m_data->graphicProviders.providers();
+    for ( auto provider : setupProviders )
+    {
+        if ( !providers.contains( provider ) )
+            providers += provider;
+    }
+
+    return providers;
+}
+
 QLocale QskSetup::inheritedLocale( const QObject* object )
 {
     VisitorLocale visitor;
@@ -47,6 +47,7 @@ class QSK_EXPORT QskSetup : public QObject
 
     void addGraphicProvider( const QString& providerId, QskGraphicProvider* );
     QskGraphicProvider* graphicProvider( const QString& providerId ) const;
+    QList< QskGraphicProvider* > graphicProviders() const;
 
     static void setup();
     static void cleanup();
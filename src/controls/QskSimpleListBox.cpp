@@ -4,47 +4,48 @@
  *****************************************************************************/
 
 #include "QskSimpleListBox.h"
+#include "QskSimpleListModel.h"
 #include "QskAspect.h"
 #include "QskFunctions.h"
 
 #include <qfontmetrics.h>
 
-static inline qreal qskMaxWidth(
-    const QFont& font, const QStringList& list )
-{
-    const QFontMetricsF fm( font );
-
-    qreal max = 0.0;
-    for ( int i = 0; i < list.size(); i++ )
-    {
-        const qreal w = qskHorizontalAdvance( fm, list[ i ] );
-        if ( w > max )
-            max = w;
-    }
-
-    return max;
-}
-
 class QskSimpleListBox::PrivateData
 {
   public:
     PrivateData()
-        : maxTextWidth( 0.0 )
-        , columnWidthHint( 0.0 )
+        : columnWidthHint( 0.0 )
+        , selectedIndex( -1 )
     {
     }
 
     // one column at the moment only
-    qreal maxTextWidth;
     qreal columnWidthHint;
 
-    QStringList entries;
+    // the selected entry, while the view of the model is reset
+    int selectedIndex;
+
+    QskSimpleListModel* model = nullptr;
 };
 
 QskSimpleListBox::QskSimpleListBox( QQuickItem* parent )
     : Inherited( parent )
     , m_data( new PrivateData() )
 {
+    auto model = new QskSimpleListModel( this );
+    m_data->model = model;
+
+    updateWidthFunction();
+
+    connect( model, &QskSimpleListModel::changed,
+        this, &QskSimpleListBox::propagateEntries );
+
+    connect( model, &QskSimpleListModel::viewAboutToBeReset,
+        this, [ this ] { m_data->selectedIndex = m_data->model->mapToIndex( selectedRow() ); } );
+
+    connect( model, &QskSimpleListModel::viewReset,
+        this, [ this ] { setSelectedRow( m_data->model->mapFromIndex( m_data->selectedIndex ) ); } );
+
     connect( this, &Inherited::selectedRowChanged,
         this, [ this ]( int row ) { Q_EMIT selectedEntryChanged( entryAt( row ) ); } );
 }
@@ -53,18 +54,20 @@ QskSimpleListBox::~QskSimpleListBox()
 {
 }
 
-QString QskSimpleListBox::entryAt( int row ) const
+QskSimpleListModel* QskSimpleListBox::model() const
 {
-    if ( row >= 0 && row < m_data->entries.size() )
-        return m_data->entries[ row ];
+    return m_data->model;
+}
 
-    return QString();
+QString QskSimpleListBox::entryAt( int row ) const
+{
+    return m_data->model->entryAt( row );
 }
 
 QVariant QskSimpleListBox::valueAt( int row, int col ) const
 {
-    if ( col == 0 && row >= 0 && row < m_data->entries.size() )
-        return m_data->entries[ row ];
+    if ( col == 0 && row >= 0 && row < m_data->model->rowCount() )
+        return m_data->model->entryAt( row );
 
     return QVariant();
 }
@@ -74,15 +77,13 @@ void QskSimpleListBox::setColumnWidthHint( int column, qreal width )
     if ( column != 0 )
         return;
 
+    width = qMax( width, qreal( 0.0 ) );
+
     if ( width != m_data->columnWidthHint )
     {
-        m_data->columnWidthHint = qMax( width, qreal( 0.0 ) );
-
-        if ( m_data->columnWidthHint > 0.0 )
-            m_data->maxTextWidth = m_data->columnWidthHint;
-        else
-            m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), m_data->entries );
+        m_data->columnWidthHint = width;
 
+        updateWidthFunction();
         updateScrollableSize();
     }
 }
@@ -100,164 +101,150 @@ void QskSimpleListBox::insert( const QStringList& list, int index )
     if ( list.isEmpty() )
         return;
 
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskMaxWidth( effectiveFont( Text ), list );
-        if ( w > m_data->maxTextWidth )
-            m_data->maxTextWidth = w;
-    }
+    auto model = m_data->model;
 
-    if ( m_data->entries.isEmpty() )
-    {
-        m_data->entries = list;
-    }
-    else if ( index < 0 || index >= m_data->entries.size() )
-    {
-        m_data->entries += list;
-    }
-    else
+    if ( index < 0 || index > model->entryCount() )
+        index = model->entryCount();
+
+    if ( index == model->entryCount() )
     {
-        // is there no better way ???
-        for ( int i = 0; i < list.size(); i++ )
-            m_data->entries.insert( index + i, list[ i ] );
+        /*
+            Appending does not move the rows of the existing entries,
+            beside when merging into a sorted view, where the
+            selection is restored from viewReset()
+         */
+        model->insert( list, index );
+        return;
     }
 
-    propagateEntries();
-}
-
-void QskSimpleListBox::setEntries( const QStringList& entries )
-{
-    if ( m_data->entries.isEmpty() && entries.isEmpty() )
-        return;
+    const int selectedIndex = model->mapToIndex( selectedRow() );
 
-    m_data->entries.clear();
+    model->insert( list, index );
 
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = 0.0;
+    if ( selectedIndex >= 0 )
+    {
+        // the selected entry might have been moved
+        const int row = model->mapFromIndex(
+            ( selectedIndex >= index ) ? selectedIndex + list.size() : selectedIndex );
 
-    insert( entries, -1 );
+        if ( row != selectedRow() )
+            setSelectedRow( row );
+    }
 }
 
-QStringList QskSimpleListBox::entries() const
+void QskSimpleListBox::insert( const QString& text, int index )
 {
-    return m_data->entries;
+    insert( QStringList( text ), index );
 }
 
-void QskSimpleListBox::insert( const QString& text, int index )
+void QskSimpleListBox::setEntries( const QStringList& entries )
 {
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskHorizontalAdvance( effectiveFont( Cell ), text );
-        if ( w > m_data->maxTextWidth )
-            m_data->maxTextWidth = w;
-    }
-
-    if ( index < 0 )
-        m_data->entries.append( text );
-    else
-        m_data->entries.insert( index, text );
+    m_data->model->setEntries( entries );
+}
 
-    propagateEntries();
+QStringList QskSimpleListBox::entries() const
+{
+    return m_data->model->entries();
 }
 
 void QskSimpleListBox::removeAt( int index )
 {
-    auto& entries = m_data->entries;
-
-    if ( index < 0 || index >= entries.size() )
-        return;
-
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskHorizontalAdvance( effectiveFont( Cell ), entries[ index ] );
-        if ( w >= m_data->maxTextWidth )
-            m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), entries );
-    }
-    else
-    {
-        entries.removeAt( index );
-    }
-
-    propagateEntries();
-
-    int row = selectedRow();
-    if ( row == index )
-    {
-        row = qMin( row, m_data->entries.size() - 1 );
-
-        if ( row != selectedRow() )
-            setSelectedRow( row );
-        else
-            Q_EMIT selectedRowChanged( row );
-    }
+    if ( index >= 0 && index < m_data->model->entryCount() )
+        removeBulk( index, index );
 }
 
 void QskSimpleListBox::removeBulk( int from, int to )
 {
+    auto model = m_data->model;
+
     if ( from < 0 )
         from = 0;
 
-    if ( to < 0 || to >= m_data->entries.size() - 1 )
-        to = m_data->entries.size() - 1;
+    if ( to < 0 || to >= model->entryCount() - 1 )
+        to = model->entryCount() - 1;
 
     if ( to < from )
         return;
 
-    for ( int i = to; i >= from; i-- )
-        m_data->entries.removeAt( i );
+    const int count = to - from + 1;
+    const int selectedIndex = model->mapToIndex( selectedRow() );
+
+    model->remove( from, count );
 
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), m_data->entries );
+    if ( selectedIndex < 0 )
+        return;
 
-    propagateEntries();
+    int row;
 
-    int row = selectedRow();
-    if ( row >= 0 )
+    if ( selectedIndex < from )
     {
-        if ( m_data->entries.isEmpty() )
-        {
-            row = -1;
-        }
-        else if ( row < from )
-        {
-            // nothing to do
-        }
-        else if ( row <= to )
-        {
-            // we might end up here with the same row TODO ...
-            row = qMin( from, m_data->entries.size() - 1 );
-        }
-        else
-        {
-            row -= ( to - from + 1 );
-        }
+        row = model->mapFromIndex( selectedIndex );
+    }
+    else if ( selectedIndex > to )
+    {
+        row = model->mapFromIndex( selectedIndex - count );
+    }
+    else
+    {
+        // the selected entry is gone, but we try to stay in the same row
+        row = qMin( selectedRow(), model->rowCount() - 1 );
 
-        if ( row != selectedRow() )
+        if ( row == selectedRow() )
         {
-            setSelectedRow( row );
+            Q_EMIT selectedRowChanged( row );
+            return;
         }
     }
+
+    if ( row != selectedRow() )
+        setSelectedRow( row );
 }
 
 void QskSimpleListBox::clear()
 {
-    if ( m_data->entries.isEmpty() )
+    if ( m_data->model->entryCount() == 0 )
         return;
 
-    m_data->entries.clear();
+    m_data->model->clear();
+    setSelectedRow( -1 );
+}
 
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = 0.0;
+void QskSimpleListBox::changeEvent( QEvent* event )
+{
+    const auto type = event->type();
 
-    propagateEntries();
-    setSelectedRow( -1 );
+    if ( type == QEvent::StyleChange || type == QEvent::FontChange )
+    {
+        // the entries have to be measured with the new font
+        updateWidthFunction();
+        updateScrollableSize();
+    }
+
+    Inherited::changeEvent( event );
+}
+
+void QskSimpleListBox::updateWidthFunction()
+{
+    if ( m_data->columnWidthHint > 0.0 )
+    {
+        // no need to measure anything
+        m_data->model->setWidthFunction( nullptr );
+    }
+    else
+    {
+        const QFontMetricsF fm( effectiveFont( Text ) );
+
+        m_data->model->setWidthFunction(
+            [ fm ]( const QString& text ) { return qskHorizontalAdvance( fm, text ); } );
+    }
 }
 
 void QskSimpleListBox::propagateEntries()
 {
-#if 1
-    // when removing we might have lost the selected row -> what to do then ?
-#endif
+    /*
+        Called once for a batch of modifications, when returning
+        to the event loop - or immediately for setEntries()/clear()
+     */
     updateScrollableSize();
     update();
 
@@ -266,7 +253,7 @@ void QskSimpleListBox::propagateEntries()
 
 int QskSimpleListBox::rowCount() const
 {
-    return m_data->entries.size();
+    return m_data->model->rowCount();
 }
 
 int QskSimpleListBox::columnCount() const
@@ -279,8 +266,11 @@ qreal QskSimpleListBox::columnWidth( int col ) const
     if ( col >= columnCount() )
         return 0.0;
 
+    const qreal textWidth = ( m_data->columnWidthHint > 0.0 )
+        ? m_data->columnWidthHint : m_data->model->maxWidth();
+
     const auto padding = paddingHint( Cell );
-    return m_data->maxTextWidth + padding.left() + padding.right();
+    return textWidth + padding.left() + padding.right();
 }
 
 qreal QskSimpleListBox::rowHeight() const
@@ -9,6 +9,8 @@
 #include "QskListView.h"
 #include <qstringlist.h>
 
+class QskSimpleListModel;
+
 class QSK_EXPORT QskSimpleListBox : public QskListView
 {
     Q_OBJECT
@@ -25,8 +27,12 @@ class QSK_EXPORT QskSimpleListBox : public QskListView
     void setColumnWidthHint( int column, qreal width );
     qreal columnWidthHint( int column ) const;
 
-    // not sure if we will keep this, but
-    // at least it is worth trying to avoid models
+    /*
+        The model allows to configure sorting/filtering. Indexes of the
+        insert/remove operations are in the order of insertion,
+        while rows are positions in the sorted/filtered view.
+     */
+    QskSimpleListModel* model() const;
 
     void insert( const QStringList&, int index );
     void insert( const QString&, int index );
@@ -54,11 +60,17 @@ class QSK_EXPORT QskSimpleListBox : public QskListView
     void clear();
 
   Q_SIGNALS:
+    // emitted once for all modifications done before returning to the event loop
     void entriesChanged();
+
     void selectedEntryChanged( const QString& );
 
+  protected:
+    void changeEvent( QEvent* ) override;
+
   private:
     void propagateEntries();
+    void updateWidthFunction();
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
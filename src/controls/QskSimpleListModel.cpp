@@ -0,0 +1,722 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskSimpleListModel.h"
+
+#include <qcoreapplication.h>
+#include <qcoreevent.h>
+#include <qmap.h>
+#include <qvector.h>
+
+#include <algorithm>
+
+namespace
+{
+    class Entry
+    {
+      public:
+        QString text;
+        qreal width;
+    };
+}
+
+Q_DECLARE_TYPEINFO( Entry, Q_MOVABLE_TYPE );
+
+namespace
+{
+    /*
+        A list of chunks with up to 2 * ChunkSize entries. Finding
+        the chunk of an index is a binary search over the offsets
+        of the chunks.
+     */
+    class ChunkedList
+    {
+      public:
+        enum { ChunkSize = 1024 };
+
+        inline int count() const { return m_count; }
+
+        inline const Entry& at( int index ) const
+        {
+            const int i = chunkIndex( index );
+            return m_chunks[ i ][ index - m_offsets[ i ] ];
+        }
+
+        inline Entry& operator[]( int index )
+        {
+            const int i = chunkIndex( index );
+            return m_chunks[ i ][ index - m_offsets[ i ] ];
+        }
+
+        void append( const Entry& entry )
+        {
+            if ( m_chunks.isEmpty() || m_chunks.last().size() >= ChunkSize )
+            {
+                m_offsets += m_count;
+
+                m_chunks += QVector< Entry >();
+                m_chunks.last().reserve( ChunkSize );
+            }
+
+            m_chunks.last() += entry;
+            m_count++;
+        }
+
+        void insert( int index, const QVector< Entry >& entries )
+        {
+            if ( index >= m_count )
+            {
+                for ( const auto& entry : entries )
+                    append( entry );
+
+                return;
+            }
+
+            const int i = chunkIndex( index );
+
+            auto& chunk = m_chunks[ i ];
+            const int pos = index - m_offsets[ i ];
+
+            chunk.insert( pos, entries.size(), Entry() );
+            for ( int k = 0; k < entries.size(); k++ )
+                chunk[ pos + k ] = entries[ k ];
+
+            if ( chunk.size() > 2 * ChunkSize )
+            {
+                const auto chunkEntries = chunk;
+                m_chunks.remove( i );
+
+                for ( int k = 0; k < chunkEntries.size(); k += ChunkSize )
+                    m_chunks.insert( i + k / ChunkSize, chunkEntries.mid( k, ChunkSize ) );
+            }
+
+            m_count += entries.size();
+            updateOffsets( i );
+        }
+
+        void remove( int index, int count )
+        {
+            const int first = chunkIndex( index );
+
+            int i = first;
+            int pos = index - m_offsets[ i ];
+
+            for ( int n = count; n > 0; )
+            {
+                auto& chunk = m_chunks[ i ];
+
+                const int k = qMin( n, int( chunk.size() ) - pos );
+                chunk.remove( pos, k );
+
+                if ( chunk.isEmpty() )
+                    m_chunks.remove( i );
+                else
+                    i++;
+
+                n -= k;
+                pos = 0;
+            }
+
+            m_count -= count;
+
+            if ( first > 0 && first < m_chunks.size() )
+            {
+                // avoiding fragmentation
+                if ( m_chunks[ first - 1 ].size() + m_chunks[ first ].size() <= ChunkSize )
+                {
+                    m_chunks[ first - 1 ] += m_chunks[ first ];
+                    m_chunks.remove( first );
+                }
+            }
+
+            updateOffsets( qMax( first - 1, 0 ) );
+        }
+
+        void clear()
+        {
+            m_chunks.clear();
+            m_offsets.clear();
+            m_count = 0;
+        }
+
+      private:
+        inline int chunkIndex( int index ) const
+        {
+            const auto it = std::upper_bound(
+                m_offsets.constBegin(), m_offsets.constEnd(), index );
+
+            return int( it - m_offsets.constBegin() ) - 1;
+        }
+
+        void updateOffsets( int from )
+        {
+            m_offsets.resize( m_chunks.size() );
+
+            for ( int i = from; i < m_chunks.size(); i++ )
+                m_offsets[ i ] = ( i == 0 ) ? 0 : m_offsets[ i - 1 ] + m_chunks[ i - 1 ].size();
+        }
+
+        QVector< QVector< Entry > > m_chunks;
+        QVector< int > m_offsets;
+
+        int m_count = 0;
+    };
+}
+
+class QskSimpleListModel::PrivateData
+{
+  public:
+    PrivateData()
+        : sortingEnabled( false )
+        , notificationPending( false )
+        , indexRowsDirty( true )
+    {
+    }
+
+    inline bool isIdentity() const
+    {
+        return !( sortingEnabled || filter );
+    }
+
+    inline bool accepts( int index ) const
+    {
+        return !filter || filter( entries.at( index ).text );
+    }
+
+    bool lessThan( int index1, int index2 ) const
+    {
+        if ( sortingEnabled )
+        {
+            const int cmp = QString::compare( entries.at( index1 ).text,
+                entries.at( index2 ).text, caseSensitivity );
+
+            if ( cmp != 0 )
+                return ( sortOrder == Qt::AscendingOrder ) ? ( cmp < 0 ) : ( cmp > 0 );
+        }
+
+        return index1 < index2;
+    }
+
+    void addWidth( qreal width )
+    {
+        widths[ width ]++;
+    }
+
+    void removeWidth( qreal width )
+    {
+        auto it = widths.find( width );
+        if ( it != widths.end() && --it.value() == 0 )
+            widths.erase( it );
+    }
+
+    inline void invalidateIndexRows()
+    {
+        indexRowsDirty = true;
+    }
+
+    int indexRow( int index )
+    {
+        if ( indexRowsDirty )
+        {
+            indexRows.fill( -1, entries.count() );
+
+            for ( int row = 0; row < rows.size(); row++ )
+                indexRows[ rows[ row ] ] = row;
+
+            indexRowsDirty = false;
+        }
+
+        return indexRows[ index ];
+    }
+
+    ChunkedList entries;
+
+    // the indexes of the entries in the sorted/filtered view
+    QVector< int > rows;
+
+    // appended entries, that are not yet merged into the sorted view
+    QVector< int > pendingRows;
+
+    // index -> row, -1 for entries not being in the view
+    QVector< int > indexRows;
+
+    Filter filter;
+    WidthFunction widthFunction;
+
+    // width -> number of entries
+    QMap< qreal, int > widths;
+
+    Qt::SortOrder sortOrder = Qt::AscendingOrder;
+    Qt::CaseSensitivity caseSensitivity = Qt::CaseInsensitive;
+
+    bool sortingEnabled : 1;
+    bool notificationPending : 1;
+    bool indexRowsDirty : 1;
+};
+
+QskSimpleListModel::QskSimpleListModel( QObject* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+}
+
+QskSimpleListModel::~QskSimpleListModel()
+{
+}
+
+void QskSimpleListModel::setEntries( const QStringList& entries )
+{
+    if ( m_data->entries.count() == 0 && entries.isEmpty() )
+        return;
+
+    m_data->entries.clear();
+    m_data->rows.clear();
+    m_data->pendingRows.clear();
+    m_data->widths.clear();
+    m_data->invalidateIndexRows();
+
+    insert( entries, -1 );
+    emitChanged();
+}
+
+QStringList QskSimpleListModel::entries() const
+{
+    QStringList entries;
+    entries.reserve( m_data->entries.count() );
+
+    for ( int i = 0; i < m_data->entries.count(); i++ )
+        entries += m_data->entries.at( i ).text;
+
+    return entries;
+}
+
+void QskSimpleListModel::insert( const QString& text, int index )
+{
+    insert( QStringList( text ), index );
+}
+
+void QskSimpleListModel::insert( const QStringList& texts, int index )
+{
+    if ( texts.isEmpty() )
+        return;
+
+    auto& entries = m_data->entries;
+
+    if ( index < 0 || index > entries.count() )
+        index = entries.count();
+
+    const bool isAppending = ( index == entries.count() );
+
+    if ( isAppending && texts.size() == 1 )
+    {
+        // the hot path, f.e. for log messages
+        Entry entry { texts[ 0 ], 0.0 };
+        if ( m_data->widthFunction )
+        {
+            entry.width = m_data->widthFunction( entry.text );
+            m_data->addWidth( entry.width );
+        }
+
+        entries.append( entry );
+    }
+    else
+    {
+        QVector< Entry > newEntries;
+        newEntries.reserve( texts.size() );
+
+        for ( const auto& text : texts )
+        {
+            Entry entry { text, 0.0 };
+            if ( m_data->widthFunction )
+            {
+                entry.width = m_data->widthFunction( text );
+                m_data->addWidth( entry.width );
+            }
+
+            newEntries += entry;
+        }
+
+        entries.insert( index, newEntries );
+    }
+
+    if ( !m_data->isIdentity() )
+    {
+        auto& rows = m_data->rows;
+
+        const int count = texts.size();
+
+        if ( isAppending && m_data->sortingEnabled && !rows.isEmpty() )
+        {
+            /*
+                Merging into the sorted view is O(n). So appended entries
+                are collected and merged in one go - when the view is
+                accessed or when returning to the event loop.
+             */
+            for ( int i = index; i < index + count; i++ )
+            {
+                if ( m_data->accepts( i ) )
+                    m_data->pendingRows += i;
+
+                if ( !m_data->indexRowsDirty )
+                    m_data->indexRows += -1;
+            }
+
+            notify();
+            return;
+        }
+
+        if ( !isAppending )
+        {
+            for ( auto& row : rows )
+            {
+                if ( row >= index )
+                    row += count;
+            }
+
+            for ( auto& row : m_data->pendingRows )
+            {
+                if ( row >= index )
+                    row += count;
+            }
+
+            m_data->invalidateIndexRows();
+        }
+
+        const int oldSize = rows.size();
+
+        for ( int i = index; i < index + count; i++ )
+        {
+            if ( m_data->accepts( i ) )
+                rows += i;
+        }
+
+        if ( rows.size() > oldSize )
+        {
+            auto lessThan = [ this ]( int index1, int index2 )
+                { return m_data->lessThan( index1, index2 ); };
+
+            const auto mid = rows.begin() + oldSize;
+
+            std::sort( mid, rows.end(), lessThan );
+
+            if ( oldSize > 0 && !lessThan( rows[ oldSize - 1 ], rows[ oldSize ] ) )
+            {
+                std::inplace_merge( rows.begin(), mid, rows.end(), lessThan );
+                m_data->invalidateIndexRows();
+            }
+        }
+
+        if ( !m_data->indexRowsDirty )
+        {
+            // the new rows have been appended to the view
+
+            for ( int i = index; i < index + count; i++ )
+                m_data->indexRows += -1;
+
+            for ( int row = oldSize; row < rows.size(); row++ )
+                m_data->indexRows[ rows[ row ] ] = row;
+        }
+    }
+
+    notify();
+}
+
+void QskSimpleListModel::remove( int index, int count )
+{
+    auto& entries = m_data->entries;
+
+    if ( index < 0 || index >= entries.count() || count <= 0 )
+        return;
+
+    count = qMin( count, entries.count() - index );
+
+    if ( m_data->widthFunction )
+    {
+        for ( int i = index; i < index + count; i++ )
+            m_data->removeWidth( entries.at( i ).width );
+    }
+
+    entries.remove( index, count );
+
+    if ( !m_data->isIdentity() )
+    {
+        for ( auto rows : { &m_data->rows, &m_data->pendingRows } )
+        {
+            int n = 0;
+            for ( int i = 0; i < rows->size(); i++ )
+            {
+                const int row = rows->at( i );
+
+                if ( row < index )
+                    ( *rows )[ n++ ] = row;
+                else if ( row >= index + count )
+                    ( *rows )[ n++ ] = row - count;
+            }
+
+            rows->resize( n );
+        }
+
+        m_data->invalidateIndexRows();
+    }
+
+    notify();
+}
+
+void QskSimpleListModel::clear()
+{
+    if ( m_data->entries.count() == 0 )
+        return;
+
+    m_data->entries.clear();
+    m_data->rows.clear();
+    m_data->pendingRows.clear();
+    m_data->widths.clear();
+    m_data->invalidateIndexRows();
+
+    emitChanged();
+}
+
+int QskSimpleListModel::entryCount() const
+{
+    return m_data->entries.count();
+}
+
+QString QskSimpleListModel::entry( int index ) const
+{
+    if ( index >= 0 && index < m_data->entries.count() )
+        return m_data->entries.at( index ).text;
+
+    return QString();
+}
+
+int QskSimpleListModel::rowCount() const
+{
+    syncRows();
+    return m_data->isIdentity() ? m_data->entries.count() : m_data->rows.size();
+}
+
+QString QskSimpleListModel::entryAt( int row ) const
+{
+    return entry( mapToIndex( row ) );
+}
+
+int QskSimpleListModel::mapToIndex( int row ) const
+{
+    if ( row < 0 || row >= rowCount() )
+        return -1;
+
+    return m_data->isIdentity() ? row : m_data->rows[ row ];
+}
+
+int QskSimpleListModel::mapFromIndex( int index ) const
+{
+    if ( index < 0 || index >= m_data->entries.count() )
+        return -1;
+
+    if ( m_data->isIdentity() )
+        return index;
+
+    syncRows();
+    return m_data->indexRow( index );
+}
+
+void QskSimpleListModel::setSortingEnabled( bool on )
+{
+    if ( on != m_data->sortingEnabled )
+    {
+        m_data->sortingEnabled = on;
+        resetView();
+    }
+}
+
+bool QskSimpleListModel::isSortingEnabled() const
+{
+    return m_data->sortingEnabled;
+}
+
+void QskSimpleListModel::setSortOrder( Qt::SortOrder order )
+{
+    if ( order != m_data->sortOrder )
+    {
+        m_data->sortOrder = order;
+
+        if ( m_data->sortingEnabled )
+            resetView();
+    }
+}
+
+Qt::SortOrder QskSimpleListModel::sortOrder() const
+{
+    return m_data->sortOrder;
+}
+
+void QskSimpleListModel::setSortCaseSensitivity( Qt::CaseSensitivity sensitivity )
+{
+    if ( sensitivity != m_data->caseSensitivity )
+    {
+        m_data->caseSensitivity = sensitivity;
+
+        if ( m_data->sortingEnabled )
+            resetView();
+    }
+}
+
+Qt::CaseSensitivity QskSimpleListModel::sortCaseSensitivity() const
+{
+    return m_data->caseSensitivity;
+}
+
+void QskSimpleListModel::setFilter( const Filter& filter )
+{
+    if ( filter || m_data->filter )
+    {
+        m_data->filter = filter;
+        resetView();
+    }
+}
+
+bool QskSimpleListModel::hasFilter() const
+{
+    return bool( m_data->filter );
+}
+
+void QskSimpleListModel::invalidateFilter()
+{
+    if ( m_data->filter )
+        resetView();
+}
+
+void QskSimpleListModel::setWidthFunction( const WidthFunction& function )
+{
+    m_data->widthFunction = function;
+    m_data->widths.clear();
+
+    auto& entries = m_data->entries;
+
+    for ( int i = 0; i < entries.count(); i++ )
+    {
+        auto& entry = entries[ i ];
+
+        if ( function )
+        {
+            entry.width = function( entry.text );
+            m_data->addWidth( entry.width );
+        }
+        else
+        {
+            entry.width = 0.0;
+        }
+    }
+}
+
+qreal QskSimpleListModel::maxWidth() const
+{
+    const auto& widths = m_data->widths;
+    return widths.isEmpty() ? 0.0 : widths.lastKey();
+}
+
+void QskSimpleListModel::resetView()
+{
+    Q_EMIT viewAboutToBeReset();
+
+    auto& rows = m_data->rows;
+    rows.clear();
+
+    m_data->pendingRows.clear();
+    m_data->invalidateIndexRows();
+
+    if ( !m_data->isIdentity() )
+    {
+        const int count = m_data->entries.count();
+
+        rows.reserve( count );
+
+        for ( int i = 0; i < count; i++ )
+        {
+            if ( m_data->accepts( i ) )
+                rows += i;
+        }
+
+        if ( m_data->sortingEnabled )
+        {
+            std::sort( rows.begin(), rows.end(),
+                [ this ]( int index1, int index2 )
+                { return m_data->lessThan( index1, index2 ); } );
+        }
+    }
+
+    Q_EMIT viewReset();
+
+    notify();
+}
+
+void QskSimpleListModel::syncRows() const
+{
+    if ( !m_data->pendingRows.isEmpty() )
+        const_cast< QskSimpleListModel* >( this )->mergeRows();
+}
+
+void QskSimpleListModel::mergeRows()
+{
+    /*
+        The pending rows are taken out first, so that the view
+        is still the old one for the slots of viewAboutToBeReset()
+     */
+    QVector< int > pendingRows;
+    pendingRows.swap( m_data->pendingRows );
+
+    if ( pendingRows.isEmpty() )
+        return;
+
+    Q_EMIT viewAboutToBeReset();
+
+    auto lessThan = [ this ]( int index1, int index2 )
+        { return m_data->lessThan( index1, index2 ); };
+
+    std::sort( pendingRows.begin(), pendingRows.end(), lessThan );
+
+    auto& rows = m_data->rows;
+    const int oldSize = rows.size();
+
+    rows += pendingRows;
+
+    std::inplace_merge( rows.begin(), rows.begin() + oldSize, rows.end(), lessThan );
+    m_data->invalidateIndexRows();
+
+    Q_EMIT viewReset();
+}
+
+void QskSimpleListModel::notify()
+{
+    if ( !m_data->notificationPending )
+    {
+        m_data->notificationPending = true;
+        QCoreApplication::postEvent( this, new QEvent( QEvent::UpdateRequest ) );
+    }
+}
+
+void QskSimpleListModel::emitChanged()
+{
+    m_data->notificationPending = false;
+
+    mergeRows();
+    Q_EMIT changed();
+}
+
+bool QskSimpleListModel::event( QEvent* event )
+{
+    if ( event->type() == QEvent::UpdateRequest )
+    {
+        // changed() might have been emitted synchronously in between
+        if ( m_data->notificationPending )
+            emitChanged();
+
+        return true;
+    }
+
+    return Inherited::event( event );
+}
+
+#include "moc_QskSimpleListModel.cpp"
@@ -0,0 +1,124 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_SIMPLE_LIST_MODEL_H
+#define QSK_SIMPLE_LIST_MODEL_H
+
+#include "QskGlobal.h"
+
+#include <qobject.h>
+#include <qstringlist.h>
+
+#include <functional>
+#include <memory>
+
+/*
+    QskSimpleListModel stores the entries of a QskSimpleListBox.
+
+    The entries are stored in chunks, so that appending is O(1) and
+    inserting/removing only moves the entries of the affected chunks.
+    The width of an entry is measured once, when being inserted, and
+    the maximum is tracked incrementally.
+
+    The entries can be presented sorted and/or filtered: the indexes
+    of the editing API are in the order of insertion, while rows
+    are positions in the sorted/filtered view.
+
+    changed() is emitted once, when returning to the event loop - no
+    matter how many modifications have been done in between. Only
+    setEntries() and clear() emit it immediately.
+
+    Appending to a non-empty sorted view is batched: the new entries are
+    merged into the view in one go, when it is accessed the next time -
+    rowCount(), entryAt(), mapToIndex(), mapFromIndex() - or when returning
+    to the event loop. As the merge rearranges the rows, it is
+    enclosed by viewAboutToBeReset() and viewReset().
+ */
+class QSK_EXPORT QskSimpleListModel : public QObject
+{
+    Q_OBJECT
+
+    using Inherited = QObject;
+
+  public:
+    using Filter = std::function< bool( const QString& ) >;
+    using WidthFunction = std::function< qreal( const QString& ) >;
+
+    QskSimpleListModel( QObject* parent = nullptr );
+    ~QskSimpleListModel() override;
+
+    void setEntries( const QStringList& );
+    QStringList entries() const;
+
+    void insert( const QStringList&, int index );
+    void insert( const QString&, int index );
+
+    void append( const QStringList& );
+    void append( const QString& );
+
+    void remove( int index, int count = 1 );
+    void clear();
+
+    int entryCount() const;
+    QString entry( int index ) const;
+
+    // the sorted/filtered view
+    int rowCount() const;
+    QString entryAt( int row ) const;
+
+    int mapToIndex( int row ) const;
+    int mapFromIndex( int index ) const;
+
+    void setSortingEnabled( bool );
+    bool isSortingEnabled() const;
+
+    void setSortOrder( Qt::SortOrder );
+    Qt::SortOrder sortOrder() const;
+
+    void setSortCaseSensitivity( Qt::CaseSensitivity );
+    Qt::CaseSensitivity sortCaseSensitivity() const;
+
+    void setFilter( const Filter& );
+    bool hasFilter() const;
+
+    // to be called, when the criteria of the filter have changed
+    void invalidateFilter();
+
+    // all entries are measured again, changed() is not emitted
+    void setWidthFunction( const WidthFunction& );
+    qreal maxWidth() const;
+
+  Q_SIGNALS:
+    void changed();
+
+    // the rows have been rearranged: sorting/filtering or merging appended entries
+    void viewAboutToBeReset();
+    void viewReset();
+
+  protected:
+    bool event( QEvent* ) override;
+
+  private:
+    void resetView();
+    void syncRows() const;
+    void mergeRows();
+    void notify();
+    void emitChanged();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+inline void QskSimpleListModel::append( const QStringList& entries )
+{
+    insert( entries, -1 );
+}
+
+inline void QskSimpleListModel::append( const QString& entry )
+{
+    insert( entry, -1 );
+}
+
+#endif
@@ -22,6 +22,8 @@ QSK_QT_PRIVATE_END
 #include <qpa/qplatformdialoghelper.h>
 #include <qpa/qplatformtheme.h>
 
+#include <qmutex.h>
+
 #include <cmath>
 #include <unordered_map>
 
@@ -79,6 +81,9 @@ QSK_QT_PRIVATE_END
 #include "QskStatusIndicator.h"
 #include "QskStatusIndicatorSkinlet.h"
 
+#include "QskSimpleVirtualKeyboard.h"
+#include "QskSimpleVirtualKeyboardSkinlet.h"
+
 static inline QskSkinlet* qskNewSkinlet( const QMetaObject* metaObject, QskSkin* skin )
 {
     const QByteArray signature = metaObject->className() + QByteArrayLiteral( "(QskSkin*)" );
@@ -121,6 +126,9 @@ class QskSkin::PrivateData
   public:
     std::unordered_map< const QMetaObject*, SkinletData > skinletMap;
 
+    // skinlets might be requested from items being built in a worker thread
+    QMutex skinletMutex;
+
     QskSkinHintTable hintTable;
     QskAspect::State stateMask = QskAspect::AllStates;
 
@@ -154,6 +162,7 @@ QskSkin::QskSkin( QObject* parent )
     declareSkinlet< QskTextLabel, QskTextLabelSkinlet >();
     declareSkinlet< QskTextInput, QskTextInputSkinlet >();
     declareSkinlet< QskProgressBar, QskProgressBarSkinlet >();
+    declareSkinlet< QskSimpleVirtualKeyboard, QskSimpleVirtualKeyboardSkinlet >();
 
     const QFont font = QGuiApplication::font();
     setupFonts( font.family(), font.weight(), font.italic() );
@@ -308,6 +317,11 @@ QskGraphicProvider* QskSkin::graphicProvider( const QString& providerId ) const
     return m_data->graphicProviders.provider( providerId );
 }
 
+QList< QskGraphicProvider* > QskSkin::graphicProviders() const
+{
+    return m_data->graphicProviders.providers();
+}
+
 bool QskSkin::hasGraphicProvider() const
 {
     return m_data->graphicProviders.size() > 0;
@@ -343,8 +357,21 @@ QskAspect::State QskSkin::stateMask() const
     return m_data->stateMask;
 }
 
+QVector< const QMetaObject* > QskSkin::declaredControls() const
+{
+    QVector< const QMetaObject* > metaObjects;
+    metaObjects.reserve( static_cast< int >( m_data->skinletMap.size() ) );
+
+    for ( const auto& entry : m_data->skinletMap )
+        metaObjects += entry.first;
+
+    return metaObjects;
+}
+
 QskSkinlet* QskSkin::skinlet( const QMetaObject* metaObject )
 {
+    QMutexLocker locker( &m_data->skinletMutex );
+
     while ( metaObject )
     {
         auto it = m_data->skinletMap.find( metaObject );
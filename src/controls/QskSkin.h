@@ -9,7 +9,9 @@
 #include "QskAspect.h"
 
 #include <qcolor.h>
+#include <qlist.h>
 #include <qobject.h>
+#include <qvector.h>
 
 #include <memory>
 #include <type_traits>
@@ -73,6 +75,7 @@ class QSK_EXPORT QskSkin : public QObject
     void addGraphicProvider( const QString& providerId, QskGraphicProvider* );
     QskGraphicProvider* graphicProvider( const QString& providerId ) const;
     bool hasGraphicProvider() const;
+    QList< QskGraphicProvider* > graphicProviders() const;
 
     virtual const int* dialogButtonLayout( Qt::Orientation ) const;
 
@@ -81,6 +84,9 @@ class QSK_EXPORT QskSkin : public QObject
 
     QskSkinlet* skinlet( const QMetaObject* );
 
+    // meta objects of the controls with a declared skinlet
+    QVector< const QMetaObject* > declaredControls() const;
+
     const QskSkinHintTable& hintTable() const;
     QskSkinHintTable& hintTable();
 
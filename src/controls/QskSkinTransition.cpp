@@ -271,6 +271,7 @@ namespace
                         graphic filters we schedule an initial update and let the
                         controls do the rest: see QskSkinnable::effectiveGraphicFilter
                      */
+                    control->setStaticNodesDirty();
                     control->update();
 #endif
                 }
@@ -294,7 +295,10 @@ namespace
                     }
 
                     if ( info.updateModes & UpdateInfo::Update )
+                    {
+                        control->setStaticNodesDirty();
                         control->update();
+                    }
                 }
             }
         }
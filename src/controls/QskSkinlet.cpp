@@ -21,6 +21,7 @@
 #include "QskTextColors.h"
 #include "QskTextNode.h"
 #include "QskTextOptions.h"
+#include "QskVectorGraphicNode.h"
 
 #include <qquickwindow.h>
 #include <qsgsimplerectnode.h>
@@ -49,15 +50,6 @@ static inline QSGNode* qskUpdateGraphicNode(
     if ( control == nullptr )
         return nullptr;
 
-    auto mode = QskTextureRenderer::OpenGL;
-
-    auto graphicNode = static_cast< QskGraphicNode* >( node );
-    if ( graphicNode == nullptr )
-        graphicNode = new QskGraphicNode();
-
-    if ( control->testUpdateFlag( QskControl::PreferRasterForTextures ) )
-        mode = QskTextureRenderer::Raster;
-
     /*
        Aligning the rect according to scene coordinates, so that
        we don't run into rounding issues downstream, where values
@@ -71,6 +63,31 @@ static inline QSGNode* qskUpdateGraphicNode(
     r = qskInnerRect( r );
     r.moveTopLeft( control->mapFromScene( r.topLeft() ) );
 
+    /*
+        The node might have been created for the other mode,
+        before the update flags have been changed.
+     */
+    if ( control->testUpdateFlag( QskControl::PreferGeometryForGraphics )
+        && QskVectorGraphicNode::canTessellate( graphic ) )
+    {
+        auto vectorNode = dynamic_cast< QskVectorGraphicNode* >( node );
+        if ( vectorNode == nullptr )
+            vectorNode = new QskVectorGraphicNode();
+
+        vectorNode->setGraphic( control->window(), graphic, colorFilter, r, mirrored );
+
+        return vectorNode;
+    }
+
+    auto mode = QskTextureRenderer::OpenGL;
+
+    auto graphicNode = dynamic_cast< QskGraphicNode* >( node );
+    if ( graphicNode == nullptr )
+        graphicNode = new QskGraphicNode();
+
+    if ( control->testUpdateFlag( QskControl::PreferRasterForTextures ) )
+        mode = QskTextureRenderer::Raster;
+
     graphicNode->setGraphic( control->window(), graphic,
         colorFilter, mode, r, mirrored );
 
@@ -120,6 +137,7 @@ class QskSkinlet::PrivateData
 
     QskSkin* skin;
     QVector< quint8 > nodeRoles;
+    QVector< quint8 > staticNodeRoles;
 
     bool ownedBySkinnable : 1;
 };
@@ -163,6 +181,21 @@ const QVector< quint8 >& QskSkinlet::nodeRoles() const
     return m_data->nodeRoles;
 }
 
+void QskSkinlet::setStaticNodeRoles( const QVector< quint8 >& nodeRoles )
+{
+    m_data->staticNodeRoles = nodeRoles;
+}
+
+const QVector< quint8 >& QskSkinlet::staticNodeRoles() const
+{
+    return m_data->staticNodeRoles;
+}
+
+bool QskSkinlet::isStaticNodeRole( quint8 nodeRole ) const
+{
+    return m_data->staticNodeRoles.contains( nodeRole );
+}
+
 void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) const
 {
     using namespace QskSGNode;
@@ -193,6 +226,8 @@ void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) cons
         replaceChildNode( DebugRole, parentNode, oldNode, newNode );
     }
 
+    const bool updateStatic = skinnable->hasDirtyStaticNodes();
+
     for ( int i = 0; i < m_data->nodeRoles.size(); i++ )
     {
         const auto nodeRole = m_data->nodeRoles[ i ];
@@ -200,10 +235,19 @@ void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) cons
         Q_ASSERT( nodeRole < FirstReservedRole );
 
         oldNode = QskSGNode::findChildNode( parentNode, nodeRole );
+
+        if ( oldNode && !updateStatic && isStaticNodeRole( nodeRole ) )
+        {
+            // only the dynamic nodes need to be updated
+            continue;
+        }
+
         newNode = updateSubNode( skinnable, nodeRole, oldNode );
 
         replaceChildNode( nodeRole, parentNode, oldNode, newNode );
     }
+
+    skinnable->setStaticNodesDirty( false );
 }
 
 QSGNode* QskSkinlet::updateBackgroundNode(
@@ -43,6 +43,9 @@ class QSK_EXPORT QskSkinlet
 
     const QVector< quint8 >& nodeRoles() const;
 
+    const QVector< quint8 >& staticNodeRoles() const;
+    bool isStaticNodeRole( quint8 ) const;
+
     void setOwnedBySkinnable( bool on );
     bool isOwnedBySkinnable() const;
 
@@ -73,6 +76,13 @@ class QSK_EXPORT QskSkinlet
     void setNodeRoles( const QVector< quint8 >& );
     void appendNodeRoles( const QVector< quint8 >& );
 
+    /*
+        Static roles are independent from the value of a control and
+        their nodes are not updated as long as the skinnable does not
+        indicate, that something has changed: see QskSkinnable::setStaticNodesDirty
+     */
+    void setStaticNodeRoles( const QVector< quint8 >& );
+
     virtual QSGNode* updateSubNode( const QskSkinnable*,
         quint8 nodeRole, QSGNode* ) const;
 
@@ -28,6 +28,8 @@
 #define DEBUG_ANIMATOR 0
 #define DEBUG_STATE 0
 
+extern bool qskIsGuiThread();
+
 static inline bool qskIsControl( const QskSkinnable* skinnable )
 {
 #if QT_VERSION >= QT_VERSION_CHECK( 5, 7, 0 )
@@ -173,6 +175,7 @@ static inline void qskTriggerUpdates( QskAspect aspect, QskControl* control )
         }
     }
 
+    control->setStaticNodesDirty();
     control->update(); // always
 
     if ( maybeLayout && control->hasChildItems() )
@@ -210,6 +213,7 @@ class QskSkinnable::PrivateData
         : skinlet( nullptr )
         , skinState( QskAspect::NoState )
         , hasLocalSkinlet( false )
+        , staticNodesDirty( true )
     {
     }
 
@@ -229,6 +233,7 @@ class QskSkinnable::PrivateData
 
     QskAspect::State skinState;
     bool hasLocalSkinlet : 1;
+    bool staticNodesDirty : 1;
 };
 
 QskSkinnable::QskSkinnable()
@@ -257,6 +262,7 @@ void QskSkinnable::setSkinlet( const QskSkinlet* skinlet )
 
     m_data->skinlet = skinlet;
     m_data->hasLocalSkinlet = ( skinlet != nullptr );
+    m_data->staticNodesDirty = true;
 
     if ( auto control = owningControl() )
     {
@@ -562,6 +568,7 @@ QskColorFilter QskSkinnable::effectiveGraphicFilter( QskAspect aspect ) const
                     on the animated graphic filters we reschedule
                     our updates here.
                  */
+                control->setStaticNodesDirty();
                 control->update();
                 return v.value< QskColorFilter >();
             }
@@ -991,6 +998,12 @@ void QskSkinnable::startHintTransition( QskAspect aspect,
     if ( control->window() == nullptr || !isTransitionAccepted( aspect ) )
         return;
 
+    if ( !qskIsGuiThread() )
+    {
+        // animators are driven by the GUI thread
+        return;
+    }
+
     /*
         We might be invalid for one of the values, when an aspect
         has not been defined for all states ( f.e. metrics are expected
@@ -1130,6 +1143,7 @@ void QskSkinnable::setSkinState( QskAspect::State newState, bool animated )
     }
 
     m_data->skinState = newState;
+    m_data->staticNodesDirty = true;
 
     if ( control->flags() & QQuickItem::ItemHasContents )
         control->update();
@@ -1155,6 +1169,16 @@ void QskSkinnable::updateNode( QSGNode* parentNode )
     effectiveSkinlet()->updateNode( this, parentNode );
 }
 
+void QskSkinnable::setStaticNodesDirty( bool on )
+{
+    m_data->staticNodesDirty = on;
+}
+
+bool QskSkinnable::hasDirtyStaticNodes() const
+{
+    return m_data->staticNodesDirty;
+}
+
 QskAspect::Subcontrol QskSkinnable::effectiveSubcontrol(
     QskAspect::Subcontrol subControl ) const
 {
@@ -131,6 +131,17 @@ class QSK_EXPORT QskSkinnable
     const char* skinStateAsPrintable() const;
     const char* skinStateAsPrintable( QskAspect::State ) const;
 
+    /*
+        Nodes of the roles, that have been declared as static
+        by the skinlet ( see QskSkinlet::setStaticNodeRoles ) are only
+        updated, when being marked as dirty. Skin hints, states and
+        geometry changes are handled by QskSkinnable/QskControl, but
+        controls have to call setStaticNodesDirty() for
+        any other property the static nodes depend on.
+     */
+    void setStaticNodesDirty( bool on = true );
+    bool hasDirtyStaticNodes() const;
+
     // type aware methods for accessing skin hints
 
     bool setColor( QskAspect, Qt::GlobalColor );
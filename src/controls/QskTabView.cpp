@@ -147,6 +147,41 @@ int QskTabView::insertTab( int index, const QString& tabText, QQuickItem* item )
     return insertTab( index, new QskTabButton( tabText ), item );
 }
 
+int QskTabView::addTab( QskTabButton* button, const PageFactory& factory )
+{
+    return insertTab( -1, button, factory );
+}
+
+int QskTabView::insertTab( int index,
+    QskTabButton* button, const PageFactory& factory )
+{
+    index = m_data->tabBar->insertTab( index, button );
+    m_data->stackBox->insertItem( index, factory );
+
+    return index;
+}
+
+int QskTabView::addTab( const QString& tabText, const PageFactory& factory )
+{
+    return insertTab( -1, tabText, factory );
+}
+
+int QskTabView::insertTab( int index,
+    const QString& tabText, const PageFactory& factory )
+{
+    return insertTab( index, new QskTabButton( tabText ), factory );
+}
+
+void QskTabView::setUnloadTimeout( int ms )
+{
+    m_data->stackBox->setUnloadTimeout( ms );
+}
+
+int QskTabView::unloadTimeout() const
+{
+    return m_data->stackBox->unloadTimeout();
+}
+
 void QskTabView::removeTab( int index )
 {
     if ( index >= 0 && index < m_data->tabBar->count() )
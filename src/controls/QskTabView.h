@@ -9,6 +9,8 @@
 #include "QskControl.h"
 #include "QskNamespace.h"
 
+#include <functional>
+
 class QskTabBar;
 class QskTabButton;
 
@@ -58,6 +60,18 @@ class QSK_EXPORT QskTabView : public QskControl
     int addTab( const QString&, QQuickItem* );
     int insertTab( int index, const QString&, QQuickItem* );
 
+    // pages, that are created when being shown for the first time
+    using PageFactory = std::function< QQuickItem*() >;
+
+    int addTab( QskTabButton*, const PageFactory& );
+    int insertTab( int index, QskTabButton*, const PageFactory& );
+
+    int addTab( const QString&, const PageFactory& );
+    int insertTab( int index, const QString&, const PageFactory& );
+
+    void setUnloadTimeout( int ms );
+    int unloadTimeout() const;
+
     void removeTab( int index );
     void clear( bool autoDelete = false );
 
@@ -4,13 +4,19 @@
  *****************************************************************************/
 
 #include "QskWindow.h"
+#include "QskWindowPrivate.h"
 #include "QskControl.h"
 #include "QskEvent.h"
 #include "QskQuick.h"
+#include "QskSGNode.h"
 #include "QskSetup.h"
 
+#include <qdebug.h>
 #include <qmath.h>
 #include <qpointer.h>
+#include <qregion.h>
+#include <qset.h>
+#include <qsgsimplerectnode.h>
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
@@ -22,7 +28,7 @@ QSK_QT_PRIVATE_END
 #include <qpa/qwindowsysteminterface.h>
 #include <QGuiApplication>
 
-// #define QSK_DEBUG_RENDER_TIMING
+#include <limits>
 
 #ifdef QSK_DEBUG_RENDER_TIMING
 
@@ -88,38 +94,67 @@ static inline int qskUpdateTimerId( const QWindow* window )
 }
 #endif
 
-namespace
+class QskWindowPrivate::DamageOverlay final : public QQuickItem
 {
-    class ChildListener final : public QQuickItemChangeListener
+  public:
+    DamageOverlay( QQuickItem* parentItem )
+        : QQuickItem( parentItem )
     {
-      public:
-        void setEnabled( QQuickItem* contentItem, bool on )
-        {
-            m_contentItem = contentItem;
+        setFlag( ItemHasContents, true );
+        setZ( std::numeric_limits< qreal >::max() );
 
-            const QQuickItemPrivate::ChangeTypes types = QQuickItemPrivate::Children;
+        qskSetTransparentForPositioner( this, true );
+    }
 
-            QQuickItemPrivate* p = QQuickItemPrivate::get( contentItem );
-            if ( on )
-                p->addItemChangeListener( this, types );
-            else
-                p->removeItemChangeListener( this, types );
+    void setRegion( const QRegion& region )
+    {
+        if ( region.isEmpty() && m_region.isEmpty() )
+            return;
+
+        m_region = region;
+        update();
+    }
+
+  protected:
+    QSGNode* updatePaintNode( QSGNode* node, UpdatePaintNodeData* ) override
+    {
+        if ( m_region.isEmpty() )
+        {
+            delete node;
+            return nullptr;
         }
 
-        void itemChildAdded( QQuickItem*, QQuickItem* ) override
+        if ( node == nullptr )
+            node = new QSGNode();
+
+        // the overlay is located at the origin of the scene
+        QSGNode* lastNode = nullptr;
+
+        for ( const auto& rect : m_region )
         {
-            QskWindow* window = static_cast< QskWindow* >( m_contentItem->window() );
-            if ( window->isExposed() )
+            auto rectNode = static_cast< QSGSimpleRectNode* >(
+                lastNode ? lastNode->nextSibling() : node->firstChild() );
+
+            if ( rectNode == nullptr )
             {
-                // the child is not fully constructed
-                QCoreApplication::postEvent( window, new QEvent( QEvent::LayoutRequest ) );
+                rectNode = new QSGSimpleRectNode();
+                rectNode->setColor( QColor( 255, 0, 0, 80 ) );
+
+                node->appendChildNode( rectNode );
             }
+
+            rectNode->setRect( rect );
+            lastNode = rectNode;
         }
 
-      private:
-        QQuickItem* m_contentItem = nullptr;
-    };
-}
+        QskSGNode::removeAllChildNodesAfter( node, lastNode );
+
+        return node;
+    }
+
+  private:
+    QRegion m_region;
+};
 
 static inline int qskToIntegerConstraint( qreal valueF )
 {
@@ -156,36 +191,79 @@ static inline QByteArray qskVisualizationMode( const QQuickWindow* window )
     return d->customRenderMode;
 #endif
 }
-class QskWindowPrivate : public QQuickWindowPrivate
+
+QskWindowPrivate::QskWindowPrivate()
+    : preferredSize( -1, -1 )
+    , eventAcceptance( QskWindow::EventProcessed )
+    , explicitLocale( false )
+    , deleteOnClose( false )
+    , autoLayoutChildren( true )
+    , damageTracking( false )
+    , sceneStatistics( false )
 {
-    Q_DECLARE_PUBLIC( QskWindow )
+}
 
-  public:
-    QskWindowPrivate()
-        : preferredSize( -1, -1 )
-        , eventAcceptance( QskWindow::EventProcessed )
-        , explicitLocale( false )
-        , deleteOnClose( false )
-        , autoLayoutChildren( true )
+QskWindowPrivate::~QskWindowPrivate()
+{
+}
+
+void QskWindowPrivate::ChildListener::setEnabled( QQuickItem* contentItem, bool on )
+{
+    m_contentItem = contentItem;
+
+    const QQuickItemPrivate::ChangeTypes types = QQuickItemPrivate::Children;
+
+    QQuickItemPrivate* p = QQuickItemPrivate::get( contentItem );
+    if ( on )
+        p->addItemChangeListener( this, types );
+    else
+        p->removeItemChangeListener( this, types );
+}
+
+void QskWindowPrivate::ChildListener::itemChildAdded( QQuickItem*, QQuickItem* )
+{
+    QskWindow* window = static_cast< QskWindow* >( m_contentItem->window() );
+    if ( window->isExposed() )
     {
+        // the child is not fully constructed
+        QCoreApplication::postEvent( window, new QEvent( QEvent::LayoutRequest ) );
     }
+}
 
-#ifdef QSK_DEBUG_RENDER_TIMING
-    QElapsedTimer renderInterval;
-#endif
+void QskWindowPrivate::addDamage( const QRectF& rect )
+{
+    pendingDamage |= rect.toAlignedRect();
+}
 
-    ChildListener contentItemListener;
-    QLocale locale;
+void QskWindowPrivate::updateSceneStatistics()
+{
+    statistics = QskSceneStatistics::collect( q_func() );
 
-    // minimum/maximum constraints are offered by QWindow
-    QSize preferredSize;
+    /*
+        Reporting each control only once, as long as it exceeds
+        the budget. As the set is rebuilt on each pass, pointers of
+        deleted controls do not survive for more than one frame.
+     */
+    QSet< const QskControl* > exceedingControls;
 
-    QskWindow::EventAcceptance eventAcceptance;
+    for ( const auto& control : qskAsConst( statistics.controls ) )
+    {
+        if ( control.counters.exceeds( nodeBudget ) )
+        {
+            exceedingControls += control.control;
+
+            if ( !reportedControls.contains( control.control ) )
+            {
+                qWarning().nospace() << "Node budget exceeded: "
+                    << control.className << " " << control.objectName
+                    << " - " << control.counters;
+            }
+        }
+    }
+
+    reportedControls = exceedingControls;
+}
 
-    bool explicitLocale : 1;
-    bool deleteOnClose : 1;
-    bool autoLayoutChildren : 1;
-};
 
 QskWindow::QskWindow( QWindow* parent )
     : Inherited( *( new QskWindowPrivate() ), parent )
@@ -214,6 +292,23 @@ QskWindow::QskWindow( QWindow* parent )
 
     if ( !qskEnforcedSkin )
         connect( this, &QQuickWindow::afterAnimating, this, &QskWindow::enforceSkin );
+
+    if ( qEnvironmentVariableIntValue( "QSK_DAMAGE_OVERLAY" ) )
+        setDamageOverlay( true );
+
+    if ( qEnvironmentVariableIsSet( "QSK_NODE_BUDGET" ) )
+    {
+        // QSK_NODE_BUDGET=nodes[,vertices[,textures]]
+
+        const auto values = qgetenv( "QSK_NODE_BUDGET" ).split( ',' );
+
+        QskSceneStatistics::Counters budget;
+        budget.nodes = values.value( 0 ).toInt();
+        budget.vertices = values.value( 1 ).toInt();
+        budget.textures = values.value( 2 ).toInt();
+
+        setNodeBudget( budget );
+    }
 }
 
 QskWindow::QskWindow( QQuickRenderControl* renderControl, QWindow* parent )
@@ -288,6 +383,135 @@ void QskWindow::setDeleteOnClose( bool on )
     }
 }
 
+void QskWindow::setDamageTracking( bool on )
+{
+    Q_D( QskWindow );
+
+    if ( on == d->damageTracking )
+        return;
+
+    d->damageTracking = on;
+
+    if ( on )
+    {
+        d->syncConnection = connect( this, &QQuickWindow::afterSynchronizing, this,
+            [ d ]()
+            {
+                // GUI thread is blocked
+                d->damagedRegion = d->pendingDamage;
+                d->pendingDamage = QRegion();
+            }, Qt::DirectConnection );
+
+        d->swapConnection = connect( this, &QQuickWindow::frameSwapped,
+            this, &QskWindow::publishDamage );
+    }
+    else
+    {
+        disconnect( d->syncConnection );
+        disconnect( d->swapConnection );
+
+        d->pendingDamage = d->damagedRegion = QRegion();
+        setDamageOverlay( false );
+    }
+}
+
+bool QskWindow::damageTracking() const
+{
+    Q_D( const QskWindow );
+    return d->damageTracking;
+}
+
+QRegion QskWindow::damagedRegion() const
+{
+    Q_D( const QskWindow );
+    return d->damagedRegion;
+}
+
+void QskWindow::setDamageOverlay( bool on )
+{
+    Q_D( QskWindow );
+
+    if ( on == ( d->damageOverlay != nullptr ) )
+        return;
+
+    if ( on )
+    {
+        setDamageTracking( true );
+        d->damageOverlay = new QskWindowPrivate::DamageOverlay( contentItem() );
+    }
+    else
+    {
+        delete d->damageOverlay;
+    }
+}
+
+bool QskWindow::damageOverlay() const
+{
+    Q_D( const QskWindow );
+    return d->damageOverlay != nullptr;
+}
+
+void QskWindow::setSceneStatisticsEnabled( bool on )
+{
+    Q_D( QskWindow );
+
+    if ( on == d->sceneStatistics )
+        return;
+
+    d->sceneStatistics = on;
+
+    if ( on )
+    {
+        d->statisticsConnection = connect( this, &QQuickWindow::afterSynchronizing,
+            this, [ d ]() { d->updateSceneStatistics(); }, Qt::DirectConnection );
+    }
+    else
+    {
+        disconnect( d->statisticsConnection );
+
+        d->statistics = QskSceneStatistics();
+        d->reportedControls.clear();
+    }
+}
+
+bool QskWindow::isSceneStatisticsEnabled() const
+{
+    Q_D( const QskWindow );
+    return d->sceneStatistics;
+}
+
+QskSceneStatistics QskWindow::sceneStatistics() const
+{
+    Q_D( const QskWindow );
+    return d->statistics;
+}
+
+void QskWindow::setNodeBudget( const QskSceneStatistics::Counters& budget )
+{
+    Q_D( QskWindow );
+
+    d->nodeBudget = budget;
+    d->reportedControls.clear();
+
+    setSceneStatisticsEnabled( true );
+}
+
+QskSceneStatistics::Counters QskWindow::nodeBudget() const
+{
+    Q_D( const QskWindow );
+    return d->nodeBudget;
+}
+
+void QskWindow::publishDamage()
+{
+    Q_D( QskWindow );
+
+    if ( d->damageOverlay )
+        d->damageOverlay->setRegion( d->damagedRegion );
+
+    Q_EMIT frameDamaged( d->damagedRegion );
+}
+
 void QskWindow::setAutoLayoutChildren( bool on )
 {
     Q_D( QskWindow );
@@ -484,7 +708,7 @@ void QskWindow::resetLocale()
 
 bool qskInheritLocale( QskWindow* window, const QLocale& locale )
 {
-    auto d = static_cast< QskWindowPrivate* >( QQuickWindowPrivate::get( window ) );
+    auto d = QskWindowPrivate::get( window );
 
     if ( d->explicitLocale || d->locale == locale )
         return false;
@@ -497,7 +721,7 @@ bool qskInheritLocale( QskWindow* window, const QLocale& locale )
 
 static void qskResolveLocale( QskWindow* window )
 {
-    auto d = static_cast< QskWindowPrivate* >( QQuickWindowPrivate::get( window ) );
+    auto d = QskWindowPrivate::get( window );
 
     const QLocale locale = qskSetup->inheritedLocale( window );
 
@@ -7,6 +7,8 @@
 #define QSK_WINDOW_H 1
 
 #include "QskGlobal.h"
+#include "QskSceneStatistics.h"
+
 #include <qquickwindow.h>
 
 class QskWindowPrivate;
@@ -69,10 +71,43 @@ class QSK_EXPORT QskWindow : public QQuickWindow
     void setEventAcceptance( EventAcceptance );
     EventAcceptance eventAcceptance() const;
 
+    /*
+        Collecting the scene rectangles of the QskQuickItems, that have
+        been updated, moved, resized, hidden or removed for a frame.
+        Items can narrow their damage down by using QskQuickItem::updateRect().
+     */
+    void setDamageTracking( bool );
+    bool damageTracking() const;
+
+    // damage of the most recent frame in scene coordinates
+    QRegion damagedRegion() const;
+
+    // highlighting the damaged regions on top of the scene
+    void setDamageOverlay( bool );
+    bool damageOverlay() const;
+
+    /*
+        Counting the nodes, vertices and textures of the QskControls
+        for each frame, broken down by the node roles of their skinlets.
+     */
+    void setSceneStatisticsEnabled( bool );
+    bool isSceneStatisticsEnabled() const;
+
+    // statistics of the most recent frame
+    QskSceneStatistics sceneStatistics() const;
+
+    /*
+        Controls exceeding one of the limits ( > 0 ) are reported
+        with qWarning. Setting a budget enables the statistics.
+     */
+    void setNodeBudget( const QskSceneStatistics::Counters& );
+    QskSceneStatistics::Counters nodeBudget() const;
+
   Q_SIGNALS:
     void localeChanged( const QLocale& );
     void autoLayoutChildrenChanged();
     void deleteOnCloseChanged();
+    void frameDamaged( const QRegion& );
 
   public Q_SLOTS:
     void setLocale( const QLocale& );
@@ -90,6 +125,7 @@ class QSK_EXPORT QskWindow : public QQuickWindow
 
   private:
     void enforceSkin();
+    void publishDamage();
 
     Q_DECLARE_PRIVATE( QskWindow )
 };
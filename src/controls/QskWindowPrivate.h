@@ -0,0 +1,98 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_WINDOW_PRIVATE_H
+#define QSK_WINDOW_PRIVATE_H
+
+#include "QskGlobal.h"
+#include "QskWindow.h"
+#include "QskSceneStatistics.h"
+
+#include <qlocale.h>
+#include <qpointer.h>
+#include <qregion.h>
+#include <qset.h>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickitemchangelistener_p.h>
+#include <private/qquickwindow_p.h>
+QSK_QT_PRIVATE_END
+
+// #define QSK_DEBUG_RENDER_TIMING
+
+#ifdef QSK_DEBUG_RENDER_TIMING
+#include <qelapsedtimer.h>
+#endif
+
+class QskControl;
+
+class QskWindowPrivate : public QQuickWindowPrivate
+{
+    Q_DECLARE_PUBLIC( QskWindow )
+
+  public:
+    static inline QskWindowPrivate* get( QskWindow* window )
+    {
+        return static_cast< QskWindowPrivate* >( QQuickWindowPrivate::get( window ) );
+    }
+
+    QskWindowPrivate();
+    ~QskWindowPrivate() override;
+
+    /*
+        called from the GUI thread or from the scene graph thread,
+        while the GUI thread is blocked
+     */
+    void addDamage( const QRectF& sceneRect );
+
+    void updateSceneStatistics();
+
+    class ChildListener final : public QQuickItemChangeListener
+    {
+      public:
+        void setEnabled( QQuickItem* contentItem, bool on );
+        void itemChildAdded( QQuickItem*, QQuickItem* ) override;
+
+      private:
+        QQuickItem* m_contentItem = nullptr;
+    };
+
+    class DamageOverlay;
+
+#ifdef QSK_DEBUG_RENDER_TIMING
+    QElapsedTimer renderInterval;
+#endif
+
+    ChildListener contentItemListener;
+    QLocale locale;
+
+    // minimum/maximum constraints are offered by QWindow
+    QSize preferredSize;
+
+    QskWindow::EventAcceptance eventAcceptance;
+
+    // collected until the next synchronization of the scene graph
+    QRegion pendingDamage;
+    QRegion damagedRegion;
+
+    QMetaObject::Connection syncConnection;
+    QMetaObject::Connection swapConnection;
+    QPointer< DamageOverlay > damageOverlay;
+
+    // collected on the scene graph thread, while the GUI thread is blocked
+    QskSceneStatistics statistics;
+    QskSceneStatistics::Counters nodeBudget;
+    QSet< const QskControl* > reportedControls;
+
+    QMetaObject::Connection statisticsConnection;
+
+    bool explicitLocale : 1;
+    bool deleteOnClose : 1;
+    bool autoLayoutChildren : 1;
+    bool damageTracking : 1;
+    bool sceneStatistics : 1;
+};
+
+#endif
@@ -8,6 +8,8 @@
 #include "QskGraphicPaintEngine.h"
 #include "QskPainterCommand.h"
 
+#include <qatomic.h>
+#include <qdatastream.h>
 #include <qguiapplication.h>
 #include <qimage.h>
 #include <qmath.h>
@@ -17,6 +19,9 @@
 #include <qpixmap.h>
 #include <qhashfunctions.h>
 
+#include <algorithm>
+#include <cstring>
+
 QSK_QT_PRIVATE_BEGIN
 #include <private/qpainter_p.h>
 #include <private/qpaintengineex_p.h>
@@ -69,8 +74,33 @@ static QRectF qskStrokedPathRect(
     return rect;
 }
 
+static inline bool qskIntersects( const QRectF& r1, const QRectF& r2 )
+{
+    /*
+        QRectF::intersects fails for rectangles without width or
+        height, but f.e. a cosmetic line might still paint something
+     */
+    return ( r1.left() <= r2.right() ) && ( r2.left() <= r1.right() )
+        && ( r1.top() <= r2.bottom() ) && ( r2.top() <= r1.bottom() );
+}
+
+static QRectF qskClipRect( const QPainter* painter, qreal margin )
+{
+    // the clip rectangle in the coordinates of the graphic
+
+    const auto transform = painter->transform();
+    if ( !transform.isInvertible() )
+        return QRectF();
+
+    auto r = transform.mapRect( painter->clipBoundingRect() );
+    r.adjust( -margin, -margin, margin, margin );
+
+    return transform.inverted().mapRect( r );
+}
+
+template< typename Command >
 static inline void qskExecCommand(
-    QPainter* painter, const QskPainterCommand& cmd,
+    QPainter* painter, const Command& cmd,
     const QskColorFilter& colorFilter,
     QskGraphic::RenderHints renderHints,
     const QTransform& transform,
@@ -323,8 +353,147 @@ namespace QskGraphicPrivate
         QRectF m_boundingRect;
         bool m_scalablePen;
     };
+
+    /*
+        A uniform grid over the bounding rectangles of the commands,
+        that paint something. Each cell stores the indexes of the commands
+        in ascending order.
+     */
+    class CommandGrid
+    {
+      public:
+        void build( const QVector< QRectF >& commandRects, const QRectF& boundingRect )
+        {
+            rect = boundingRect;
+
+            int count = 0;
+            for ( const auto& r : commandRects )
+            {
+                if ( r.width() >= 0.0 )
+                    count++;
+            }
+
+            // aiming at ~4 commands per cell
+            const qreal area = qMax( rect.width() * rect.height(), qreal( 1.0 ) );
+            const qreal cellSize = qMax( qSqrt( area / qMax( count / 4, 1 ) ), qreal( 1e-6 ) );
+
+            columns = qBound( 1, qCeil( rect.width() / cellSize ), 256 );
+            rows = qBound( 1, qCeil( rect.height() / cellSize ), 256 );
+
+            offsets.fill( 0, columns * rows + 1 );
+
+            for ( const auto& r : commandRects )
+            {
+                if ( r.width() >= 0.0 )
+                    forEachCell( r, [ this ]( int cell ) { offsets[ cell + 1 ]++; } );
+            }
+
+            for ( int i = 1; i < offsets.size(); i++ )
+                offsets[ i ] += offsets[ i - 1 ];
+
+            indexes.resize( offsets.last() );
+
+            auto pos = offsets;
+
+            for ( int i = 0; i < commandRects.size(); i++ )
+            {
+                const auto& r = commandRects[ i ];
+                if ( r.width() >= 0.0 )
+                    forEachCell( r, [ &, i ]( int cell ) { indexes[ pos[ cell ]++ ] = i; } );
+            }
+        }
+
+        QVector< int > intersecting(
+            const QVector< QRectF >& commandRects, const QRectF& area ) const
+        {
+            QVector< int > result;
+
+            forEachCell( area, [ & ]( int cell )
+            {
+                for ( int i = offsets[ cell ]; i < offsets[ cell + 1 ]; i++ )
+                {
+                    const int index = indexes[ i ];
+                    if ( qskIntersects( commandRects[ index ], area ) )
+                        result += index;
+                }
+            } );
+
+            std::sort( result.begin(), result.end() );
+            result.erase( std::unique( result.begin(), result.end() ), result.end() );
+
+            return result;
+        }
+
+        bool isValid( int commandCount ) const
+        {
+            if ( columns <= 0 || rows <= 0 || offsets.size() != columns * rows + 1 )
+                return false;
+
+            if ( offsets.first() != 0 || offsets.last() != indexes.size() )
+                return false;
+
+            for ( int i = 1; i < offsets.size(); i++ )
+            {
+                if ( offsets[ i ] < offsets[ i - 1 ] )
+                    return false;
+            }
+
+            for ( const auto index : indexes )
+            {
+                if ( index < 0 || index >= commandCount )
+                    return false;
+            }
+
+            return true;
+        }
+
+        QRectF rect;
+
+        int columns = 0;
+        int rows = 0;
+
+        QVector< int > offsets;
+        QVector< int > indexes;
+
+      private:
+        template< typename T >
+        inline void forEachCell( const QRectF& r, T function ) const
+        {
+            if ( !qskIntersects( r, rect ) )
+                return;
+
+            const qreal cw = rect.width() / columns;
+            const qreal ch = rect.height() / rows;
+
+            int col0 = 0, col1 = columns - 1;
+            if ( cw > 0.0 )
+            {
+                col0 = qBound( 0, qFloor( ( r.left() - rect.left() ) / cw ), columns - 1 );
+                col1 = qBound( 0, qFloor( ( r.right() - rect.left() ) / cw ), columns - 1 );
+            }
+
+            int row0 = 0, row1 = rows - 1;
+            if ( ch > 0.0 )
+            {
+                row0 = qBound( 0, qFloor( ( r.top() - rect.top() ) / ch ), rows - 1 );
+                row1 = qBound( 0, qFloor( ( r.bottom() - rect.top() ) / ch ), rows - 1 );
+            }
+
+            for ( int row = row0; row <= row1; row++ )
+            {
+                for ( int col = col0; col <= col1; col++ )
+                    function( row * columns + col );
+            }
+        }
+    };
 }
 
+/*
+    Below this number of commands replaying everything is
+    cheaper than building and querying the grid
+ */
+static const int qskMinIndexedCommands = 64;
+
 class QskGraphic::PrivateData : public QSharedData
 {
   public:
@@ -339,12 +508,21 @@ class QskGraphic::PrivateData : public QSharedData
         , defaultSize( other.defaultSize )
         , commands( other.commands )
         , pathInfos( other.pathInfos )
+        , commandRects( other.commandRects )
         , boundingRect( other.boundingRect )
         , pointRect( other.pointRect )
         , modificationId( other.modificationId )
+        , penWidth( other.penWidth )
+        , cosmeticPenWidth( other.cosmeticPenWidth )
         , commandTypes( other.commandTypes )
         , renderHints( other.renderHints )
     {
+        // the grid is not shared as the copy is about to be modified
+    }
+
+    ~PrivateData()
+    {
+        delete grid.loadAcquire();
     }
 
     inline bool operator==( const PrivateData& other ) const
@@ -354,23 +532,64 @@ class QskGraphic::PrivateData : public QSharedData
             ( defaultSize == other.defaultSize );
     }
 
-    inline void addCommand( const QskPainterCommand& command )
+    inline void commandAdded()
     {
-        commands += command;
+        commandRects += QRectF( 0.0, 0.0, -1.0, -1.0 );
+
+        resetGrid();
 
         static QAtomicInteger< quint64 > nextId( 1 );
         modificationId = nextId.fetchAndAddRelaxed( 1 );
     }
 
+    inline void resetGrid()
+    {
+        delete grid.fetchAndStoreOrdered( nullptr );
+    }
+
+    const QskGraphicPrivate::CommandGrid* commandGrid() const
+    {
+        auto g = grid.loadAcquire();
+        if ( g == nullptr )
+        {
+            /*
+                Graphics are shared between the GUI and the render
+                threads, so we might be racing with another thread here.
+             */
+            auto newGrid = new QskGraphicPrivate::CommandGrid();
+            newGrid->build( commandRects, boundingRect );
+
+            if ( grid.testAndSetOrdered( nullptr, newGrid ) )
+            {
+                g = newGrid;
+            }
+            else
+            {
+                delete newGrid;
+                g = grid.loadAcquire();
+            }
+        }
+
+        return g;
+    }
+
     QSizeF defaultSize;
-    QVector< QskPainterCommand > commands;
+    QskPainterCommandBuffer commands;
     QVector< QskGraphicPrivate::PathInfo > pathInfos;
 
+    // parallel to commands, invalid for commands that don't paint
+    QVector< QRectF > commandRects;
+    mutable QAtomicPointer< QskGraphicPrivate::CommandGrid > grid;
+
     QRectF boundingRect = { 0.0, 0.0, -1.0, -1.0 };
     QRectF pointRect = { 0.0, 0.0, -1.0, -1.0 };
 
     quint64 modificationId = 0;
 
+    // max. widths of the stroking pens: for extending the clip rectangle
+    qreal penWidth = 0.0;
+    qreal cosmeticPenWidth = 0.0;
+
     uint commandTypes : 4;
     uint renderHints : 4;
 };
@@ -482,7 +701,10 @@ void QskGraphic::reset()
 {
     m_data->commands.clear();
     m_data->pathInfos.clear();
+    m_data->commandRects.clear();
+    m_data->resetGrid();
 
+    m_data->penWidth = m_data->cosmeticPenWidth = 0.0;
     m_data->commandTypes = 0;
 
     m_data->boundingRect = QRectF( 0.0, 0.0, -1.0, -1.0 );
@@ -613,18 +835,67 @@ void QskGraphic::render( QPainter* painter,
     if ( isNull() )
         return;
 
-    const int numCommands = m_data->commands.size();
-    const auto commands = m_data->commands.constData();
+    const auto& commands = m_data->commands;
+    const int numCommands = commands.size();
 
     const auto transform = painter->transform();
     const QskGraphic::RenderHints renderHints( m_data->renderHints );
 
+    /*
+        When painting into a clip, we only replay the commands, that
+        intersect with it. The state commands always have to be executed.
+     */
+    QVector< int > indexes;
+    bool culling = false;
+
+    if ( painter->hasClipping() && numCommands >= qskMinIndexedCommands )
+    {
+        // pens, that are not scaled, might paint beyond the recorded rectangles
+
+        qreal penWidth = m_data->cosmeticPenWidth;
+        if ( renderHints & RenderPensUnscaled )
+            penWidth = qMax( penWidth, m_data->penWidth );
+
+        const auto clipRect = qskClipRect( painter, 0.5 * penWidth + 1.0 );
+
+        if ( clipRect.isValid() && !clipRect.contains( m_data->boundingRect ) )
+        {
+            indexes = m_data->commandGrid()->intersecting(
+                m_data->commandRects, clipRect );
+
+            culling = true;
+        }
+    }
+
     painter->save();
 
-    for ( int i = 0; i < numCommands; i++ )
+    if ( culling )
+    {
+        int pos = 0;
+
+        for ( int i = 0; i < numCommands; i++ )
+        {
+            const auto command = commands[ i ];
+
+            if ( command.type() != QskPainterCommand::State )
+            {
+                if ( pos >= indexes.size() || indexes[ pos ] != i )
+                    continue;
+
+                pos++;
+            }
+
+            qskExecCommand( painter, command, colorFilter,
+                renderHints, transform, initialTransform );
+        }
+    }
+    else
     {
-        qskExecCommand( painter, commands[ i ], colorFilter,
-            renderHints, transform, initialTransform );
+        for ( int i = 0; i < numCommands; i++ )
+        {
+            qskExecCommand( painter, commands[ i ], colorFilter,
+                renderHints, transform, initialTransform );
+        }
     }
 
     painter->restore();
@@ -849,7 +1120,8 @@ void QskGraphic::drawPath( const QPainterPath& path )
     if ( painter == nullptr )
         return;
 
-    m_data->addCommand( QskPainterCommand( path ) );
+    m_data->commands.appendPath( path );
+    m_data->commandAdded();
     m_data->commandTypes |= QskGraphic::VectorData;
 
     if ( !path.isEmpty() )
@@ -859,10 +1131,18 @@ void QskGraphic::drawPath( const QPainterPath& path )
         QRectF pointRect = scaledPath.boundingRect();
         QRectF boundingRect = pointRect;
 
-        if ( painter->pen().style() != Qt::NoPen &&
-            painter->pen().brush().style() != Qt::NoBrush )
+        const auto pen = painter->pen();
+
+        if ( pen.style() != Qt::NoPen && pen.brush().style() != Qt::NoBrush )
         {
             boundingRect = qskStrokedPathRect( painter, path );
+
+            const qreal pw = qMax( pen.widthF(), qreal( 1.0 ) );
+
+            if ( pen.isCosmetic() )
+                m_data->cosmeticPenWidth = qMax( m_data->cosmeticPenWidth, pw );
+            else
+                m_data->penWidth = qMax( m_data->penWidth, pw );
         }
 
         updateControlPointRect( pointRect );
@@ -880,7 +1160,8 @@ void QskGraphic::drawPixmap( const QRectF& rect,
     if ( painter == nullptr )
         return;
 
-    m_data->addCommand( QskPainterCommand( rect, pixmap, subRect ) );
+    m_data->commands.appendPixmap( rect, pixmap, subRect );
+    m_data->commandAdded();
     m_data->commandTypes |= QskGraphic::RasterData;
 
     const QRectF r = painter->transform().mapRect( rect );
@@ -895,7 +1176,8 @@ void QskGraphic::drawImage( const QRectF& rect, const QImage& image,
     if ( painter == nullptr )
         return;
 
-    m_data->addCommand( QskPainterCommand( rect, image, subRect, flags ) );
+    m_data->commands.appendImage( rect, image, subRect, flags );
+    m_data->commandAdded();
     m_data->commandTypes |= QskGraphic::RasterData;
 
     const QRectF r = painter->transform().mapRect( rect );
@@ -906,7 +1188,8 @@ void QskGraphic::drawImage( const QRectF& rect, const QImage& image,
 
 void QskGraphic::updateState( const QPaintEngineState& state )
 {
-    m_data->addCommand( QskPainterCommand( state ) );
+    m_data->commands.appendState( state );
+    m_data->commandAdded();
 
     if ( state.state() & QPaintEngine::DirtyTransform )
     {
@@ -942,6 +1225,9 @@ void QskGraphic::updateBoundingRect( const QRectF& rect )
         m_data->boundingRect = br;
     else
         m_data->boundingRect |= br;
+
+    // always called for the command, that has been added last
+    m_data->commandRects.last() = br;
 }
 
 void QskGraphic::updateControlPointRect( const QRectF& rect )
@@ -952,7 +1238,7 @@ void QskGraphic::updateControlPointRect( const QRectF& rect )
         m_data->pointRect |= rect;
 }
 
-const QVector< QskPainterCommand >& QskGraphic::commands() const
+const QskPainterCommandBuffer& QskGraphic::commands() const
 {
     return m_data->commands;
 }
@@ -984,6 +1270,28 @@ void QskGraphic::setCommands( const QVector< QskPainterCommand >& commands )
     painter.end();
 }
 
+QRectF QskGraphic::commandRect( int index ) const
+{
+    if ( index < 0 || index >= m_data->commandRects.size() )
+        return QRectF();
+
+    const auto& r = m_data->commandRects[ index ];
+    return ( r.width() < 0.0 ) ? QRectF() : r;
+}
+
+QVector< int > QskGraphic::commandsAt( const QRectF& rect ) const
+{
+    if ( isNull() || !rect.isValid() )
+        return QVector< int >();
+
+    return m_data->commandGrid()->intersecting( m_data->commandRects, rect );
+}
+
+QVector< int > QskGraphic::commandsAt( const QPointF& pos ) const
+{
+    return commandsAt( QRectF( pos, QSizeF( 0.0, 0.0 ) ) );
+}
+
 quint64 QskGraphic::modificationId() const
 {
     return m_data->modificationId;
@@ -999,6 +1307,57 @@ uint QskGraphic::hash( uint seed ) const
     return qHash( m_data->modificationId, hash );
 }
 
+static const char qskIndexMagicNumber[] = "QSKI";
+
+void qskWriteCommandIndex( const QskGraphic& graphic, QDataStream& stream )
+{
+    if ( graphic.m_data->commands.size() < qskMinIndexedCommands )
+        return;
+
+    const auto grid = graphic.m_data->commandGrid();
+
+    stream.writeRawData( qskIndexMagicNumber, 4 );
+    stream << grid->rect;
+    stream << static_cast< qint32 >( grid->columns );
+    stream << static_cast< qint32 >( grid->rows );
+    stream << grid->offsets << grid->indexes;
+}
+
+bool qskReadCommandIndex( QskGraphic& graphic, QDataStream& stream )
+{
+    char magicNumber[ 4 ];
+    if ( stream.readRawData( magicNumber, 4 ) != 4
+        || memcmp( magicNumber, qskIndexMagicNumber, 4 ) != 0 )
+    {
+        return false;
+    }
+
+    auto grid = new QskGraphicPrivate::CommandGrid();
+
+    qint32 columns, rows;
+
+    stream >> grid->rect >> columns >> rows;
+    stream >> grid->offsets >> grid->indexes;
+
+    grid->columns = columns;
+    grid->rows = rows;
+
+    auto& d = *graphic.m_data;
+
+    if ( stream.status() != QDataStream::Ok
+        || grid->rect != d.boundingRect || !grid->isValid( d.commands.size() ) )
+    {
+        // the grid will be rebuilt, when being needed
+        delete grid;
+        return false;
+    }
+
+    d.resetGrid();
+    d.grid.storeRelease( grid );
+
+    return true;
+}
+
 QskGraphic QskGraphic::fromImage( const QImage& image )
 {
     QskGraphic graphic;
@@ -14,6 +14,7 @@
 #include <qshareddata.h>
 
 class QskPainterCommand;
+class QskPainterCommandBuffer;
 class QskColorFilter;
 class QskGraphicPaintEngine;
 class QImage;
@@ -22,6 +23,7 @@ class QPainterPath;
 class QPaintEngine;
 class QPaintEngineState;
 class QTransform;
+class QDataStream;
 class QDebug;
 
 class QSK_EXPORT QskGraphic : public QPaintDevice
@@ -95,9 +97,21 @@ class QSK_EXPORT QskGraphic : public QPaintDevice
     QRectF boundingRect() const;
     QRectF controlPointRect() const;
 
-    const QVector< QskPainterCommand >& commands() const;
+    const QskPainterCommandBuffer& commands() const;
     void setCommands( const QVector< QskPainterCommand >& );
 
+    /*
+        Indexes of the commands, whose bounding rectangles intersect
+        with rect/pos - in painting order. The lookups are done with
+        a spatial index, that is built, when being needed for the first time.
+        The same index is used for skipping commands, when rendering into
+        a clipped painter.
+     */
+    QVector< int > commandsAt( const QRectF& ) const;
+    QVector< int > commandsAt( const QPointF& ) const;
+
+    QRectF commandRect( int index ) const;
+
     void setDefaultSize( const QSizeF& );
     QSizeF defaultSize() const;
 
@@ -134,6 +148,9 @@ class QSK_EXPORT QskGraphic : public QPaintDevice
     virtual void updateState( const QPaintEngineState& state );
 
   private:
+    friend void qskWriteCommandIndex( const QskGraphic&, QDataStream& );
+    friend bool qskReadCommandIndex( QskGraphic&, QDataStream& );
+
     void updateBoundingRect( const QRectF& );
     void updateControlPointRect( const QRectF& );
 
@@ -16,6 +16,9 @@
 
 static const char qskMagicNumber[] = "QSKG";
 
+extern void qskWriteCommandIndex( const QskGraphic&, QDataStream& );
+extern bool qskReadCommandIndex( QskGraphic&, QDataStream& );
+
 static inline void qskWritePathData(
     const QPainterPath& path, QDataStream& s )
 {
@@ -272,6 +275,13 @@ QskGraphic QskGraphicIO::read( QIODevice* dev )
     QskGraphic graphic;
     graphic.setCommands( commands );
 
+    /*
+        Files might have an optional spatial index of the commands
+        appended, that is ignored by older versions of QSkinny.
+     */
+    if ( !stream.atEnd() )
+        qskReadCommandIndex( graphic, stream );
+
     return graphic;
 }
 
@@ -302,35 +312,34 @@ bool QskGraphicIO::write( const QskGraphic& graphic, QIODevice* dev )
     stream.setByteOrder( QDataStream::BigEndian );
     stream.writeRawData( qskMagicNumber, 4 );
 
-    const int numCommands = graphic.commands().size();
-    const QskPainterCommand* cmds = graphic.commands().constData();
+    const auto& commands = graphic.commands();
 
-    stream << static_cast< quint32 >( numCommands );
+    stream << static_cast< quint32 >( commands.size() );
 
-    for ( int i = 0; i < numCommands; i++ )
+    for ( const auto& command : commands )
     {
-        stream << static_cast< quint8 >( cmds[ i ].type() );
+        stream << static_cast< quint8 >( command.type() );
 
-        switch ( cmds[ i ].type() )
+        switch ( command.type() )
         {
             case QskPainterCommand::Path:
             {
-                qskWritePathData( *cmds[ i ].path(), stream );
+                qskWritePathData( *command.path(), stream );
                 break;
             }
             case QskPainterCommand::Pixmap:
             {
-                qskWritePixmapData( *cmds[ i ].pixmapData(), stream );
+                qskWritePixmapData( *command.pixmapData(), stream );
                 break;
             }
             case QskPainterCommand::Image:
             {
-                qskWriteImageData( *cmds[ i ].imageData(), stream );
+                qskWriteImageData( *command.imageData(), stream );
                 break;
             }
             case QskPainterCommand::State:
             {
-                qskWriteStateData( *cmds[ i ].stateData(), stream );
+                qskWriteStateData( *command.stateData(), stream );
                 break;
             }
             default:
@@ -341,5 +350,7 @@ bool QskGraphicIO::write( const QskGraphic& graphic, QIODevice* dev )
         }
     }
 
+    qskWriteCommandIndex( graphic, stream );
+
     return true;
 }
@@ -10,6 +10,7 @@
 #include <qmutex.h>
 #include <qcache.h>
 #include <qdebug.h>
+#include <qstringlist.h>
 #include <qurl.h>
 
 class QskGraphicProvider::PrivateData
@@ -89,6 +90,11 @@ const QskGraphic* QskGraphicProvider::requestGraphic( const QString& id ) const
     return graphic;
 }
 
+QStringList QskGraphicProvider::graphicIds() const
+{
+    return QStringList();
+}
+
 void Qsk::addGraphicProvider(
     const QString& providerId, QskGraphicProvider* provider )
 {
@@ -13,6 +13,7 @@
 
 class QskGraphic;
 class QUrl;
+class QStringList;
 
 class QSK_EXPORT QskGraphicProvider : public QObject
 {
@@ -27,6 +28,9 @@ class QSK_EXPORT QskGraphicProvider : public QObject
 
     const QskGraphic* requestGraphic( const QString& id ) const;
 
+    // ids of graphics, that are known in advance ( f.e for prewarming )
+    virtual QStringList graphicIds() const;
+
   protected:
     virtual const QskGraphic* loadGraphic( const QString& id ) const = 0;
 
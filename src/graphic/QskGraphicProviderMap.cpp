@@ -82,6 +82,19 @@ QskGraphicProvider* QskGraphicProviderMap::provider( const QString& providerId )
     return it.value();
 }
 
+QList< QskGraphicProvider* > QskGraphicProviderMap::providers() const
+{
+    QList< QskGraphicProvider* > providers;
+
+    for ( auto it = m_data->hashTab.constBegin(); it != m_data->hashTab.constEnd(); ++it )
+    {
+        if ( it.value() )
+            providers += it.value();
+    }
+
+    return providers;
+}
+
 int QskGraphicProviderMap::size() const
 {
     // might not be correct, when providers have been deleted
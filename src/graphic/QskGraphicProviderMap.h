@@ -7,6 +7,8 @@
 #define QSK_GRAPHIC_PROVIDER_MAP_H
 
 #include "QskGlobal.h"
+
+#include <qlist.h>
 #include <memory>
 
 class QskGraphicProvider;
@@ -26,6 +28,7 @@ class QSK_EXPORT QskGraphicProviderMap
     QskGraphicProvider* take( const QString& providerId );
 
     QskGraphicProvider* provider( const QString& providerId ) const;
+    QList< QskGraphicProvider* > providers() const;
 
     int size() const;
 
@@ -5,106 +5,175 @@
 
 #include "QskPainterCommand.h"
 
-QskPainterCommand::QskPainterCommand( const QPainterPath& path )
-    : m_type( Path )
-{
-    m_path = new QPainterPath( path );
-}
+#include <utility>
 
-QskPainterCommand::QskPainterCommand( const QRectF& rect,
-        const QPixmap& pixmap, const QRectF& subRect )
-    : m_type( Pixmap )
+template< typename Shared, typename T >
+static inline Shared* qskCreateShared( const T& data )
 {
-    m_pixmapData = new PixmapData();
-    m_pixmapData->rect = rect;
-    m_pixmapData->pixmap = pixmap;
-    m_pixmapData->subRect = subRect;
+    auto shared = new Shared( data );
+    shared->ref.ref();
+
+    return shared;
 }
 
-QskPainterCommand::QskPainterCommand( const QRectF& rect,
-        const QImage& image, const QRectF& subRect, Qt::ImageConversionFlags flags )
-    : m_type( Image )
+template< typename T >
+static inline void qskReleaseShared( T* shared ) noexcept
 {
-    m_imageData = new ImageData();
-    m_imageData->rect = rect;
-    m_imageData->image = image;
-    m_imageData->subRect = subRect;
-    m_imageData->flags = flags;
+    if ( !shared->ref.deref() )
+        delete shared;
 }
 
-QskPainterCommand::QskPainterCommand( const QskPainterCommand::StateData& data )
-    : m_type( State )
+template< typename T >
+static inline T* qskDetachShared( T*& shared )
 {
-    m_stateData = new StateData( data );
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 14, 0 )
+    const bool isShared = shared->ref.loadRelaxed() != 1;
+#else
+    const bool isShared = shared->ref.load() != 1;
+#endif
+
+    if ( isShared )
+    {
+        auto copy = new T( *shared );
+        copy->ref.ref();
+
+        qskReleaseShared( shared );
+        shared = copy;
+    }
+
+    return shared;
 }
 
-QskPainterCommand::QskPainterCommand( const QPaintEngineState& state )
-    : m_type( State )
+static void qskInitStateData(
+    QskPainterCommand::StateData& data, const QPaintEngineState& state )
 {
-    m_stateData = new StateData();
+    data.flags = state.state();
 
-    m_stateData->flags = state.state();
+    if ( data.flags & QPaintEngine::DirtyPen )
+        data.pen = state.pen();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyPen )
-        m_stateData->pen = state.pen();
+    if ( data.flags & QPaintEngine::DirtyBrush )
+        data.brush = state.brush();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyBrush )
-        m_stateData->brush = state.brush();
+    if ( data.flags & QPaintEngine::DirtyBrushOrigin )
+        data.brushOrigin = state.brushOrigin();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyBrushOrigin )
-        m_stateData->brushOrigin = state.brushOrigin();
+    if ( data.flags & QPaintEngine::DirtyFont )
+        data.font = state.font();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyFont )
-        m_stateData->font = state.font();
-
-    if ( m_stateData->flags & QPaintEngine::DirtyBackground )
+    if ( data.flags & QPaintEngine::DirtyBackground )
     {
-        m_stateData->backgroundMode = state.backgroundMode();
-        m_stateData->backgroundBrush = state.backgroundBrush();
+        data.backgroundMode = state.backgroundMode();
+        data.backgroundBrush = state.backgroundBrush();
     }
 
-    if ( m_stateData->flags & QPaintEngine::DirtyTransform )
-        m_stateData->transform = state.transform();
+    if ( data.flags & QPaintEngine::DirtyTransform )
+        data.transform = state.transform();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyClipEnabled )
-        m_stateData->isClipEnabled = state.isClipEnabled();
+    if ( data.flags & QPaintEngine::DirtyClipEnabled )
+        data.isClipEnabled = state.isClipEnabled();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyClipRegion )
+    if ( data.flags & QPaintEngine::DirtyClipRegion )
     {
-        m_stateData->clipRegion = state.clipRegion();
-        m_stateData->clipOperation = state.clipOperation();
+        data.clipRegion = state.clipRegion();
+        data.clipOperation = state.clipOperation();
     }
 
-    if ( m_stateData->flags & QPaintEngine::DirtyClipPath )
+    if ( data.flags & QPaintEngine::DirtyClipPath )
     {
-        m_stateData->clipPath = state.clipPath();
-        m_stateData->clipOperation = state.clipOperation();
+        data.clipPath = state.clipPath();
+        data.clipOperation = state.clipOperation();
     }
 
-    if ( m_stateData->flags & QPaintEngine::DirtyHints )
-        m_stateData->renderHints = state.renderHints();
+    if ( data.flags & QPaintEngine::DirtyHints )
+        data.renderHints = state.renderHints();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyCompositionMode )
-        m_stateData->compositionMode = state.compositionMode();
+    if ( data.flags & QPaintEngine::DirtyCompositionMode )
+        data.compositionMode = state.compositionMode();
 
-    if ( m_stateData->flags & QPaintEngine::DirtyOpacity )
-        m_stateData->opacity = state.opacity();
+    if ( data.flags & QPaintEngine::DirtyOpacity )
+        data.opacity = state.opacity();
 }
 
-QskPainterCommand::QskPainterCommand( const QskPainterCommand& other )
+QskPainterCommand::QskPainterCommand( const QPainterPath& path )
+    : m_type( Path )
+{
+    new ( &m_path ) QPainterPath( path );
+}
+
+QskPainterCommand::QskPainterCommand( const QRectF& rect,
+        const QPixmap& pixmap, const QRectF& subRect )
+    : m_type( Pixmap )
+{
+    PixmapData data;
+    data.rect = rect;
+    data.pixmap = pixmap;
+    data.subRect = subRect;
+
+    m_pixmapData = qskCreateShared< SharedData< PixmapData > >( data );
+}
+
+QskPainterCommand::QskPainterCommand( const QRectF& rect,
+        const QImage& image, const QRectF& subRect, Qt::ImageConversionFlags flags )
+    : m_type( Image )
+{
+    ImageData data;
+    data.rect = rect;
+    data.image = image;
+    data.subRect = subRect;
+    data.flags = flags;
+
+    m_imageData = qskCreateShared< SharedData< ImageData > >( data );
+}
+
+QskPainterCommand::QskPainterCommand( const QskPainterCommand::StateData& data )
+    : m_type( State )
+{
+    m_stateData = qskCreateShared< SharedData< StateData > >( data );
+}
+
+QskPainterCommand::QskPainterCommand( const QPaintEngineState& state )
+    : m_type( State )
+{
+    StateData data;
+    qskInitStateData( data, state );
+
+    m_stateData = qskCreateShared< SharedData< StateData > >( data );
+}
+
+QskPainterCommand::QskPainterCommand( const QskPainterCommand& other ) noexcept
 {
     copy( other );
 }
 
+QskPainterCommand::QskPainterCommand( QskPainterCommand&& other ) noexcept
+{
+    move( other );
+}
+
 QskPainterCommand::~QskPainterCommand()
 {
     reset();
 }
 
-QskPainterCommand& QskPainterCommand::operator=( const QskPainterCommand& other )
+QskPainterCommand& QskPainterCommand::operator=( const QskPainterCommand& other ) noexcept
 {
-    reset();
-    copy( other );
+    if ( this != &other )
+    {
+        reset();
+        copy( other );
+    }
+
+    return *this;
+}
+
+QskPainterCommand& QskPainterCommand::operator=( QskPainterCommand&& other ) noexcept
+{
+    if ( this != &other )
+    {
+        reset();
+        move( other );
+    }
 
     return *this;
 }
@@ -130,8 +199,11 @@ bool QskPainterCommand::operator==( const QskPainterCommand& other ) const noexc
         }
         case State:
         {
-            const StateData& sd = *m_stateData;
-            const StateData& osd = *other.m_stateData;
+            if ( m_stateData == other.m_stateData )
+                return true;
+
+            const StateData& sd = m_stateData->data;
+            const StateData& osd = other.m_stateData->data;
 
             if ( sd.flags != osd.flags )
                 return false;
@@ -226,7 +298,7 @@ bool QskPainterCommand::operator==( const QskPainterCommand& other ) const noexc
     return true;
 }
 
-void QskPainterCommand::copy( const QskPainterCommand& other )
+void QskPainterCommand::copy( const QskPainterCommand& other ) noexcept
 {
     m_type = other.m_type;
 
@@ -234,51 +306,75 @@ void QskPainterCommand::copy( const QskPainterCommand& other )
     {
         case Path:
         {
-            m_path = new QPainterPath( *other.m_path );
+            new ( &m_path ) QPainterPath( other.m_path );
             break;
         }
         case Pixmap:
         {
-            m_pixmapData = new PixmapData( *other.m_pixmapData );
+            m_pixmapData = other.m_pixmapData;
+            m_pixmapData->ref.ref();
             break;
         }
         case Image:
         {
-            m_imageData = new ImageData( *other.m_imageData );
+            m_imageData = other.m_imageData;
+            m_imageData->ref.ref();
             break;
         }
         case State:
         {
-            m_stateData = new StateData( *other.m_stateData );
+            m_stateData = other.m_stateData;
+            m_stateData->ref.ref();
             break;
         }
         default:
+        {
+            m_pixmapData = nullptr;
             break;
+        }
     }
 }
 
-void QskPainterCommand::reset()
+void QskPainterCommand::move( QskPainterCommand& other ) noexcept
+{
+    if ( other.m_type == Path )
+    {
+        // the moved path stays valid: no need to reset other
+        m_type = Path;
+        new ( &m_path ) QPainterPath( std::move( other.m_path ) );
+
+        return;
+    }
+
+    m_type = other.m_type;
+    m_pixmapData = other.m_pixmapData;
+
+    other.m_type = Invalid;
+    other.m_pixmapData = nullptr;
+}
+
+void QskPainterCommand::reset() noexcept
 {
     switch ( m_type )
     {
         case Path:
         {
-            delete m_path;
+            m_path.~QPainterPath();
             break;
         }
         case Pixmap:
         {
-            delete m_pixmapData;
+            qskReleaseShared( m_pixmapData );
             break;
         }
         case Image:
         {
-            delete m_imageData;
+            qskReleaseShared( m_imageData );
             break;
         }
         case State:
         {
-            delete m_stateData;
+            qskReleaseShared( m_stateData );
             break;
         }
         default:
@@ -286,24 +382,139 @@ void QskPainterCommand::reset()
     }
 
     m_type = Invalid;
+    m_pixmapData = nullptr;
 }
 
 QPainterPath* QskPainterCommand::path() noexcept
 {
-    return m_path;
+    return ( m_type == Path ) ? &m_path : nullptr;
+}
+
+QskPainterCommand::PixmapData* QskPainterCommand::pixmapData()
+{
+    if ( m_type != Pixmap )
+        return nullptr;
+
+    return &qskDetachShared( m_pixmapData )->data;
+}
+
+QskPainterCommand::ImageData* QskPainterCommand::imageData()
+{
+    if ( m_type != Image )
+        return nullptr;
+
+    return &qskDetachShared( m_imageData )->data;
+}
+
+QskPainterCommand::StateData* QskPainterCommand::stateData()
+{
+    if ( m_type != State )
+        return nullptr;
+
+    return &qskDetachShared( m_stateData )->data;
 }
 
-QskPainterCommand::PixmapData* QskPainterCommand::pixmapData() noexcept
+QskPainterCommand QskPainterCommandBuffer::Command::toCommand() const
 {
-    return m_pixmapData;
+    const auto& record = m_buffer->m_records[ m_index ];
+
+    switch ( record.type )
+    {
+        case QskPainterCommand::Path:
+            return QskPainterCommand( *path() );
+
+        case QskPainterCommand::Pixmap:
+        {
+            const auto data = pixmapData();
+            return QskPainterCommand( data->rect, data->pixmap, data->subRect );
+        }
+        case QskPainterCommand::Image:
+        {
+            const auto data = imageData();
+            return QskPainterCommand( data->rect,
+                data->image, data->subRect, data->flags );
+        }
+        case QskPainterCommand::State:
+            return QskPainterCommand( *stateData() );
+
+        default:
+            break;
+    }
+
+    return QskPainterCommand();
 }
 
-QskPainterCommand::ImageData* QskPainterCommand::imageData() noexcept
+void QskPainterCommandBuffer::addRecord( QskPainterCommand::Type type, int index )
 {
-    return m_imageData;
+    m_records += Record { type, index };
 }
 
-QskPainterCommand::StateData* QskPainterCommand::stateData() noexcept
+void QskPainterCommandBuffer::appendPath( const QPainterPath& path )
 {
-    return m_stateData;
+    addRecord( QskPainterCommand::Path, m_paths.size() );
+    m_paths += path;
+}
+
+void QskPainterCommandBuffer::appendPixmap( const QRectF& rect,
+    const QPixmap& pixmap, const QRectF& subRect )
+{
+    addRecord( QskPainterCommand::Pixmap, m_pixmaps.size() );
+    m_pixmaps += QskPainterCommand::PixmapData { rect, pixmap, subRect };
+}
+
+void QskPainterCommandBuffer::appendImage( const QRectF& rect,
+    const QImage& image, const QRectF& subRect, Qt::ImageConversionFlags flags )
+{
+    addRecord( QskPainterCommand::Image, m_images.size() );
+    m_images += QskPainterCommand::ImageData { rect, image, subRect, flags };
+}
+
+void QskPainterCommandBuffer::appendState( const QPaintEngineState& state )
+{
+    addRecord( QskPainterCommand::State, m_states.size() );
+
+    m_states.resize( m_states.size() + 1 );
+    qskInitStateData( m_states.last(), state );
+}
+
+void QskPainterCommandBuffer::append( const QskPainterCommand& command )
+{
+    switch ( command.type() )
+    {
+        case QskPainterCommand::Path:
+        {
+            appendPath( *command.path() );
+            break;
+        }
+        case QskPainterCommand::Pixmap:
+        {
+            const auto data = command.pixmapData();
+            appendPixmap( data->rect, data->pixmap, data->subRect );
+            break;
+        }
+        case QskPainterCommand::Image:
+        {
+            const auto data = command.imageData();
+            appendImage( data->rect, data->image, data->subRect, data->flags );
+            break;
+        }
+        case QskPainterCommand::State:
+        {
+            addRecord( QskPainterCommand::State, m_states.size() );
+            m_states += *command.stateData();
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void QskPainterCommandBuffer::clear()
+{
+    m_records.clear();
+
+    m_paths.clear();
+    m_pixmaps.clear();
+    m_images.clear();
+    m_states.clear();
 }
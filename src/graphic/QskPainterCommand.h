@@ -12,6 +12,8 @@
 #include <qpaintengine.h>
 #include <qpainterpath.h>
 #include <qpixmap.h>
+#include <qshareddata.h>
+#include <qvector.h>
 
 class QSK_EXPORT QskPainterCommand
 {
@@ -76,7 +78,8 @@ class QSK_EXPORT QskPainterCommand
     };
 
     constexpr QskPainterCommand() noexcept;
-    QskPainterCommand( const QskPainterCommand& );
+    QskPainterCommand( const QskPainterCommand& ) noexcept;
+    QskPainterCommand( QskPainterCommand&& ) noexcept;
 
     explicit QskPainterCommand( const QPainterPath& );
 
@@ -92,7 +95,8 @@ class QSK_EXPORT QskPainterCommand
 
     ~QskPainterCommand();
 
-    QskPainterCommand& operator=( const QskPainterCommand& );
+    QskPainterCommand& operator=( const QskPainterCommand& ) noexcept;
+    QskPainterCommand& operator=( QskPainterCommand&& ) noexcept;
 
     bool operator==( const QskPainterCommand& other ) const noexcept;
     bool operator!=( const QskPainterCommand& other ) const noexcept;
@@ -102,33 +106,141 @@ class QSK_EXPORT QskPainterCommand
     QPainterPath* path() noexcept;
     const QPainterPath* path() const noexcept;
 
-    PixmapData* pixmapData() noexcept;
+    PixmapData* pixmapData();
     const PixmapData* pixmapData() const noexcept;
 
-    ImageData* imageData() noexcept;
+    ImageData* imageData();
     const ImageData* imageData() const noexcept;
 
-    StateData* stateData() noexcept;
+    StateData* stateData();
     const StateData* stateData() const noexcept;
 
   private:
-    void copy( const QskPainterCommand& );
-    void reset();
+    /*
+        Paths are stored in place, as QPainterPath is implicitly shared
+        itself. The attributes of all other commands are shared between
+        copies and detached, when being modified.
+     */
+    template< typename T >
+    class SharedData : public QSharedData
+    {
+      public:
+        SharedData() = default;
+
+        SharedData( const T& data )
+            : data( data )
+        {
+        }
+
+        T data;
+    };
+
+    void copy( const QskPainterCommand& ) noexcept;
+    void move( QskPainterCommand& ) noexcept;
+    void reset() noexcept;
 
     Type m_type;
 
     union
     {
-        QPainterPath* m_path;
-        PixmapData* m_pixmapData;
-        ImageData* m_imageData;
-        StateData* m_stateData;
+        QPainterPath m_path;
+        SharedData< PixmapData >* m_pixmapData;
+        SharedData< ImageData >* m_imageData;
+        SharedData< StateData >* m_stateData;
     };
 };
 
+Q_DECLARE_TYPEINFO( QskPainterCommand, Q_MOVABLE_TYPE );
+
+/*
+    The recorded commands of a QskGraphic: a table of small records
+    referring to contiguous arrays of paths, pixmaps, images and states.
+    All arrays are implicitly shared, so copies of a graphic share
+    the buffer, and adding a command does not allocate a block of its own.
+ */
+class QSK_EXPORT QskPainterCommandBuffer
+{
+  public:
+    // lightweight reference to a command inside the buffer
+    class Command
+    {
+      public:
+        QskPainterCommand::Type type() const noexcept;
+
+        const QPainterPath* path() const noexcept;
+        const QskPainterCommand::PixmapData* pixmapData() const noexcept;
+        const QskPainterCommand::ImageData* imageData() const noexcept;
+        const QskPainterCommand::StateData* stateData() const noexcept;
+
+        QskPainterCommand toCommand() const;
+
+      private:
+        friend class QskPainterCommandBuffer;
+
+        Command( const QskPainterCommandBuffer*, int index ) noexcept;
+
+        const QskPainterCommandBuffer* m_buffer;
+        int m_index;
+    };
+
+    class const_iterator
+    {
+      public:
+        Command operator*() const noexcept;
+        const_iterator& operator++() noexcept;
+
+        bool operator==( const const_iterator& ) const noexcept;
+        bool operator!=( const const_iterator& ) const noexcept;
+
+      private:
+        friend class QskPainterCommandBuffer;
+
+        const_iterator( const QskPainterCommandBuffer*, int index ) noexcept;
+
+        const QskPainterCommandBuffer* m_buffer;
+        int m_index;
+    };
+
+    int size() const noexcept;
+    bool isEmpty() const noexcept;
+
+    Command at( int index ) const noexcept;
+    Command operator[]( int index ) const noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    void appendPath( const QPainterPath& );
+    void appendPixmap( const QRectF& rect, const QPixmap&, const QRectF& subRect );
+
+    void appendImage( const QRectF& rect, const QImage&,
+        const QRectF& subRect, Qt::ImageConversionFlags );
+
+    void appendState( const QPaintEngineState& );
+    void append( const QskPainterCommand& );
+
+    void clear();
+
+  private:
+    struct Record
+    {
+        QskPainterCommand::Type type;
+        int index; // into the array of the type
+    };
+
+    void addRecord( QskPainterCommand::Type, int index );
+
+    QVector< Record > m_records;
+
+    QVector< QPainterPath > m_paths;
+    QVector< QskPainterCommand::PixmapData > m_pixmaps;
+    QVector< QskPainterCommand::ImageData > m_images;
+    QVector< QskPainterCommand::StateData > m_states;
+};
+
 constexpr inline QskPainterCommand::QskPainterCommand() noexcept
     : m_type( Invalid )
-    , m_path( nullptr )
+    , m_pixmapData( nullptr )
 {
 }
 
@@ -146,28 +258,141 @@ inline QskPainterCommand::Type QskPainterCommand::type() const noexcept
 //! \return Painter path to be painted
 inline const QPainterPath* QskPainterCommand::path() const noexcept
 {
-    return m_path;
+    return ( m_type == Path ) ? &m_path : nullptr;
 }
 
 //! \return Attributes how to paint a QPixmap
 inline const QskPainterCommand::PixmapData*
 QskPainterCommand::pixmapData() const noexcept
 {
-    return m_pixmapData;
+    return ( m_type == Pixmap ) ? &m_pixmapData->data : nullptr;
 }
 
 //! \return Attributes how to paint a QImage
 inline const QskPainterCommand::ImageData*
 QskPainterCommand::imageData() const noexcept
 {
-    return m_imageData;
+    return ( m_type == Image ) ? &m_imageData->data : nullptr;
 }
 
 //! \return Attributes of a state change
 inline const QskPainterCommand::StateData*
 QskPainterCommand::stateData() const noexcept
 {
-    return m_stateData;
+    return ( m_type == State ) ? &m_stateData->data : nullptr;
+}
+
+inline QskPainterCommandBuffer::Command::Command(
+        const QskPainterCommandBuffer* buffer, int index ) noexcept
+    : m_buffer( buffer )
+    , m_index( index )
+{
+}
+
+inline QskPainterCommand::Type QskPainterCommandBuffer::Command::type() const noexcept
+{
+    return m_buffer->m_records[ m_index ].type;
+}
+
+inline const QPainterPath* QskPainterCommandBuffer::Command::path() const noexcept
+{
+    const auto& record = m_buffer->m_records[ m_index ];
+
+    return ( record.type == QskPainterCommand::Path )
+        ? m_buffer->m_paths.constData() + record.index : nullptr;
+}
+
+inline const QskPainterCommand::PixmapData*
+QskPainterCommandBuffer::Command::pixmapData() const noexcept
+{
+    const auto& record = m_buffer->m_records[ m_index ];
+
+    return ( record.type == QskPainterCommand::Pixmap )
+        ? m_buffer->m_pixmaps.constData() + record.index : nullptr;
+}
+
+inline const QskPainterCommand::ImageData*
+QskPainterCommandBuffer::Command::imageData() const noexcept
+{
+    const auto& record = m_buffer->m_records[ m_index ];
+
+    return ( record.type == QskPainterCommand::Image )
+        ? m_buffer->m_images.constData() + record.index : nullptr;
+}
+
+inline const QskPainterCommand::StateData*
+QskPainterCommandBuffer::Command::stateData() const noexcept
+{
+    const auto& record = m_buffer->m_records[ m_index ];
+
+    return ( record.type == QskPainterCommand::State )
+        ? m_buffer->m_states.constData() + record.index : nullptr;
+}
+
+inline QskPainterCommandBuffer::const_iterator::const_iterator(
+        const QskPainterCommandBuffer* buffer, int index ) noexcept
+    : m_buffer( buffer )
+    , m_index( index )
+{
+}
+
+inline QskPainterCommandBuffer::Command
+QskPainterCommandBuffer::const_iterator::operator*() const noexcept
+{
+    return m_buffer->at( m_index );
+}
+
+inline QskPainterCommandBuffer::const_iterator&
+QskPainterCommandBuffer::const_iterator::operator++() noexcept
+{
+    m_index++;
+    return *this;
+}
+
+inline bool QskPainterCommandBuffer::const_iterator::operator==(
+    const const_iterator& other ) const noexcept
+{
+    return ( m_buffer == other.m_buffer ) && ( m_index == other.m_index );
+}
+
+inline bool QskPainterCommandBuffer::const_iterator::operator!=(
+    const const_iterator& other ) const noexcept
+{
+    return !( *this == other );
+}
+
+inline int QskPainterCommandBuffer::size() const noexcept
+{
+    return m_records.size();
+}
+
+inline bool QskPainterCommandBuffer::isEmpty() const noexcept
+{
+    return m_records.isEmpty();
+}
+
+inline QskPainterCommandBuffer::Command
+QskPainterCommandBuffer::at( int index ) const noexcept
+{
+    return Command( this, index );
+}
+
+inline QskPainterCommandBuffer::Command
+QskPainterCommandBuffer::operator[]( int index ) const noexcept
+{
+    return Command( this, index );
+}
+
+inline QskPainterCommandBuffer::const_iterator
+QskPainterCommandBuffer::begin() const noexcept
+{
+    return const_iterator( this, 0 );
+}
+
+inline QskPainterCommandBuffer::const_iterator
+QskPainterCommandBuffer::end() const noexcept
+{
+    return const_iterator( this, m_records.size() );
 }
 
 #endif
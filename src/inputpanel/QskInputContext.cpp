@@ -13,6 +13,8 @@
 #include "QskQuick.h"
 #include "QskWindow.h"
 
+#include <qbasictimer.h>
+#include <qelapsedtimer.h>
 #include <qguiapplication.h>
 #include <qmap.h>
 #include <qpointer.h>
@@ -37,6 +39,9 @@ namespace
 
             m_box = new QskInputPanelBox( this );
 
+            if ( qEnvironmentVariableIntValue( "QSK_SIMPLE_KEYBOARD" ) )
+                m_box->setPanelHint( QskInputPanelBox::SimpleKeyboard, true );
+
             connect( m_box, &QskInputPanelBox::keySelected,
                 this, &QskInputPanel::keySelected );
 
@@ -272,15 +277,77 @@ class QskInputContext::PrivateData
 
     void closeChannel( Channel* channel )
     {
+        if ( pooling && channel->panel )
+        {
+            channel->panel->attachInputItem( nullptr );
+
+            if ( channel->popup )
+                channel->popup->close();
+
+            if ( channel->window )
+                channel->window->hide();
+
+            channel->item = nullptr;
+            pool += *channel;
+
+            return;
+        }
+
         if ( channel->popup )
-            channel->popup->close(); // deleteOnClose is set
+        {
+            channel->popup->setPopupFlag( QskPopup::DeleteOnClose, true );
+            channel->popup->close();
+        }
 
         if ( channel->window )
-            channel->window->close(); // deleteOnClose is set
+        {
+            channel->window->setDeleteOnClose( true );
+            channel->window->close();
+        }
+    }
+
+    Channel takePooledChannel( const QLocale& locale )
+    {
+        int index = -1;
+
+        for ( int i = 0; i < pool.count(); i++ )
+        {
+            const auto panel = pool[ i ].panel;
+
+            if ( panel && ( panel->locale() == locale ) )
+            {
+                index = i;
+                break;
+            }
+
+            if ( panel && index < 0 )
+                index = i;
+        }
+
+        Channel channel;
+
+        if ( index >= 0 )
+        {
+            channel = pool[ index ];
+            pool.remove( index );
+        }
+
+        return channel;
     }
 
     ChannelTable channels;
     QPointer< QskInputContextFactory > factory;
+
+    // hidden panels, ready for being reused
+    QVector< Channel > pool;
+    QVector< QLocale > preloadLocales;
+    QBasicTimer preloadTimer;
+
+    QElapsedTimer showTimer;
+    QMetaObject::Connection frameConnection;
+    qreal showLatency = -1.0;
+
+    bool pooling = false;
 };
 
 QskInputContext::QskInputContext()
@@ -291,6 +358,8 @@ QskInputContext::QskInputContext()
 
 QskInputContext::~QskInputContext()
 {
+    for ( const auto& channel : qskAsConst( m_data->pool ) )
+        delete channel.window;
 }
 
 void QskInputContext::setFactory( QskInputContextFactory* factory )
@@ -376,7 +445,22 @@ void QskInputContext::showPanel( const QQuickItem* item )
         hidePanel( channel->item );
     }
 
-    auto panel = m_data->createPanel( this );
+    m_data->showTimer.start();
+
+    Channel pooledChannel;
+
+    if ( m_data->pooling )
+    {
+        QInputMethodQueryEvent event( Qt::ImPreferredLanguage );
+        QCoreApplication::sendEvent( const_cast< QQuickItem* >( item ), &event );
+
+        pooledChannel = m_data->takePooledChannel(
+            event.value( Qt::ImPreferredLanguage ).toLocale() );
+    }
+
+    auto panel = pooledChannel.panel.data();
+    if ( panel == nullptr )
+        panel = m_data->createPanel( this );
 
     auto channel = m_data->channels.insert( item->window() );
     channel->item = const_cast< QQuickItem* >( item );
@@ -386,19 +470,34 @@ void QskInputContext::showPanel( const QQuickItem* item )
     {
         // The input panel is embedded in a top level window
 
-        auto window = m_data->createWindow( panel );
-
-        QSize size = window->sizeConstraint();
-        if ( size.isEmpty() )
+        auto window = pooledChannel.window.data();
+        if ( window == nullptr )
         {
-            // no idea, may be something based on the screen size
-            size = QSize( 800, 240 );
+            if ( auto popup = pooledChannel.popup.data() )
+            {
+                // the dialog policy has changed
+                if ( panel->parent() == popup )
+                    panel->setParent( nullptr );
+
+                panel->setParentItem( nullptr );
+                delete popup;
+            }
+
+            window = m_data->createWindow( panel );
+
+            QSize size = window->sizeConstraint();
+            if ( size.isEmpty() )
+            {
+                // no idea, may be something based on the screen size
+                size = QSize( 800, 240 );
+            }
+
+            window->resize( size );
         }
 
-        window->resize( size );
         window->show();
 
-        window->setDeleteOnClose( true );
+        window->setDeleteOnClose( !m_data->pooling );
 
         channel->window = window;
     }
@@ -406,9 +505,20 @@ void QskInputContext::showPanel( const QQuickItem* item )
     {
         // The input panel is embedded in a popup
 
-        auto popup = m_data->createPopup( panel );
+        auto popup = pooledChannel.popup.data();
+        if ( popup == nullptr )
+        {
+            if ( auto window = pooledChannel.window.data() )
+            {
+                // the dialog policy has changed
+                panel->setParentItem( nullptr );
+                delete window;
+            }
+
+            popup = m_data->createPopup( panel );
+        }
 
-        popup->setPopupFlag( QskPopup::DeleteOnClose, true );
+        popup->setPopupFlag( QskPopup::DeleteOnClose, !m_data->pooling );
         popup->setParentItem( item->window()->contentItem() );
         popup->setParent( this );
 
@@ -418,6 +528,8 @@ void QskInputContext::showPanel( const QQuickItem* item )
     }
 
     panel->attachInputItem( const_cast< QQuickItem* >( item ) );
+
+    measureShowLatency( channel->window ? channel->window.data() : item->window() );
 }
 
 void QskInputContext::hidePanel( const QQuickItem* item )
@@ -442,6 +554,118 @@ void QskInputContext::hideChannel( const QskInputPanel* panel )
     }
 }
 
+void QskInputContext::setPanelPooling( bool on )
+{
+    if ( on == m_data->pooling )
+        return;
+
+    m_data->pooling = on;
+
+    if ( !on )
+    {
+        m_data->preloadLocales.clear();
+        m_data->preloadTimer.stop();
+
+        for ( const auto& channel : qskAsConst( m_data->pool ) )
+        {
+            if ( channel.popup )
+                channel.popup->deleteLater();
+            else if ( channel.panel )
+                channel.panel->deleteLater();
+
+            delete channel.window;
+        }
+
+        m_data->pool.clear();
+    }
+}
+
+bool QskInputContext::hasPanelPooling() const
+{
+    return m_data->pooling;
+}
+
+void QskInputContext::preloadPanels( const QVector< QLocale >& locales )
+{
+    setPanelPooling( true );
+
+    m_data->preloadLocales += locales;
+
+    if ( !m_data->preloadLocales.isEmpty() )
+        m_data->preloadTimer.start( 0, this );
+}
+
+qreal QskInputContext::lastShowLatency() const
+{
+    return m_data->showLatency;
+}
+
+void QskInputContext::measureShowLatency( QQuickWindow* window )
+{
+    disconnect( m_data->frameConnection );
+
+    if ( window == nullptr )
+        return;
+
+    /*
+        frameSwapped might be emitted from the scene graph thread,
+        what adds the delay of the queued connection to the measurement.
+     */
+    m_data->frameConnection = connect( window, &QQuickWindow::frameSwapped, this,
+        [ this ]()
+        {
+            disconnect( m_data->frameConnection );
+
+            m_data->showLatency = m_data->showTimer.nsecsElapsed() / 1e6;
+            Q_EMIT panelShown( m_data->showLatency );
+        } );
+}
+
+void QskInputContext::timerEvent( QTimerEvent* event )
+{
+    if ( event->timerId() == m_data->preloadTimer.timerId() )
+    {
+        /*
+            A timer with an interval of 0 is processed, when there are
+            no other pending events. We create one panel per timeout
+            to keep the application responsive.
+         */
+        if ( !m_data->preloadLocales.isEmpty() )
+        {
+            const auto locale = m_data->preloadLocales.takeFirst();
+
+            auto panel = m_data->createPanel( this );
+            panel->setLocale( locale );
+
+            Channel channel;
+            channel.panel = panel;
+
+            if ( QskDialog::instance()->policy() == QskDialog::TopLevelWindow )
+            {
+                channel.window = m_data->createWindow( panel );
+            }
+            else
+            {
+                // initially closed
+                channel.popup = m_data->createPopup( panel );
+                channel.popup->setParent( this );
+            }
+
+            if ( panel->parent() == nullptr )
+                panel->setParent( this );
+
+            m_data->pool += channel;
+        }
+
+        if ( m_data->preloadLocales.isEmpty() )
+            m_data->preloadTimer.stop();
+
+        return;
+    }
+
+    Inherited::timerEvent( event );
+}
+
 void QskInputContext::setInputPanelVisible( const QQuickItem* item, bool on )
 {
     // called from inside the controls
@@ -11,6 +11,7 @@
 #include <qinputmethod.h>
 #include <qnamespace.h>
 #include <qobject.h>
+#include <qvector.h>
 
 #include <memory>
 
@@ -20,6 +21,8 @@ class QskInputEngine;
 class QskPopup;
 class QskWindow;
 class QQuickItem;
+class QQuickWindow;
+class QLocale;
 
 class QSK_EXPORT QskInputContextFactory : public QObject
 {
@@ -58,16 +61,37 @@ class QSK_EXPORT QskInputContext : public QObject
 
     QskTextPredictor* textPredictor( const QLocale& locale );
 
+    /*
+        With pooling, panels are not destroyed when being hidden,
+        but kept for input items coming later - even those of other windows.
+     */
+    void setPanelPooling( bool );
+    bool hasPanelPooling() const;
+
+    /*
+        Creates pooled panels for the locales in advance. Panels are
+        created one by one, when the event loop is idle.
+     */
+    void preloadPanels( const QVector< QLocale >& );
+
+    // time in ms from showing a panel until the first frame displaying it
+    qreal lastShowLatency() const;
+
   Q_SIGNALS:
     void activeChanged();
     void panelRectChanged();
 
+    void panelShown( qreal latency );
+
   protected:
     virtual void showPanel( const QQuickItem* );
     virtual void hidePanel( const QQuickItem* );
 
+    void timerEvent( QTimerEvent* ) override;
+
   private:
     void hideChannel( const QskInputPanel* );
+    void measureShowLatency( QQuickWindow* );
 
     // called from QskPlatformInputContext
     friend class QskPlatformInputContext;
@@ -195,7 +195,11 @@ namespace
 
                 predictor->request( m_preedit );
 
-                if ( predictor->candidateCount() > 0 )
+                /*
+                    When the candidates are delivered later we can't
+                    decide yet and have to continue with the preedit text
+                 */
+                if ( predictor->isDeferred() || predictor->candidateCount() > 0 )
                 {
                     result.text = m_preedit;
                     result.isFinal = false;
@@ -6,6 +6,7 @@
 #include "QskInputPanelBox.h"
 #include "QskInputPredictionBar.h"
 #include "QskLinearBox.h"
+#include "QskSimpleVirtualKeyboard.h"
 #include "QskTextInput.h"
 #include "QskTextLabel.h"
 #include "QskVirtualKeyboard.h"
@@ -55,6 +56,14 @@ namespace
     };
 }
 
+static inline bool qskHasKey( const QskControl* keyboard, int keyCode )
+{
+    if ( auto simpleKeyboard = qobject_cast< const QskSimpleVirtualKeyboard* >( keyboard ) )
+        return simpleKeyboard->hasKey( keyCode );
+
+    return static_cast< const QskVirtualKeyboard* >( keyboard )->hasKey( keyCode );
+}
+
 QSK_SUBCONTROL( QskInputPanelBox, Panel )
 QSK_SUBCONTROL( QskInputPanelBox, ProxyPanel )
 QSK_SUBCONTROL( QskInputPanelBox, ProxyText )
@@ -68,7 +77,7 @@ class QskInputPanelBox::PrivateData
     QskTextLabel* prompt;
     TextInputProxy* inputProxy;
     QskInputPredictionBar* predictionBar;
-    QskVirtualKeyboard* keyboard;
+    QskControl* keyboard = nullptr;
 
     QskInputPanelBox::PanelHints panelHints = QskInputPanelBox::InputProxy;
 };
@@ -90,8 +99,6 @@ QskInputPanelBox::QskInputPanelBox( QQuickItem* parent )
     m_data->predictionBar->setVisible(
         m_data->panelHints & QskInputPanelBox::Prediction );
 
-    m_data->keyboard = new QskVirtualKeyboard();
-
     auto layout = new QskLinearBox( Qt::Vertical, this );
     layout->setDefaultAlignment( Qt::AlignLeft | Qt::AlignHCenter );
 
@@ -99,15 +106,13 @@ QskInputPanelBox::QskInputPanelBox( QQuickItem* parent )
     layout->addItem( m_data->inputProxy );
     layout->addStretch( 10 );
     layout->addItem( m_data->predictionBar );
-    layout->addItem( m_data->keyboard );
 
     m_data->layout = layout;
 
     connect( m_data->predictionBar, &QskInputPredictionBar::predictiveTextSelected,
         this, &QskInputPanelBox::predictiveTextSelected );
 
-    connect( m_data->keyboard, &QskVirtualKeyboard::keySelected,
-        this, &QskInputPanelBox::keySelected );
+    updateKeyboard();
 }
 
 QskInputPanelBox::~QskInputPanelBox()
@@ -137,9 +142,52 @@ void QskInputPanelBox::setPanelHints( PanelHints hints )
 
     m_data->prompt->setVisible( showPrompt );
 
+    updateKeyboard();
+
     Q_EMIT panelHintsChanged();
 }
 
+void QskInputPanelBox::updateKeyboard()
+{
+    const bool simple = m_data->panelHints & QskInputPanelBox::SimpleKeyboard;
+
+    auto oldKeyboard = m_data->keyboard;
+
+    if ( oldKeyboard )
+    {
+        const bool isSimple =
+            qobject_cast< const QskSimpleVirtualKeyboard* >( oldKeyboard ) != nullptr;
+
+        if ( isSimple == simple )
+            return;
+
+        m_data->layout->removeItem( oldKeyboard );
+    }
+
+    if ( simple )
+    {
+        auto simpleKeyboard = new QskSimpleVirtualKeyboard();
+
+        connect( simpleKeyboard, &QskSimpleVirtualKeyboard::keySelected,
+            this, &QskInputPanelBox::keySelected );
+
+        m_data->keyboard = simpleKeyboard;
+    }
+    else
+    {
+        auto virtualKeyboard = new QskVirtualKeyboard();
+
+        connect( virtualKeyboard, &QskVirtualKeyboard::keySelected,
+            this, &QskInputPanelBox::keySelected );
+
+        m_data->keyboard = virtualKeyboard;
+    }
+
+    m_data->layout->addItem( m_data->keyboard );
+
+    delete oldKeyboard;
+}
+
 QskInputPanelBox::PanelHints QskInputPanelBox::panelHints() const
 {
     return m_data->panelHints;
@@ -242,7 +290,7 @@ void QskInputPanelBox::keyPressEvent( QKeyEvent* event )
         }
     }
 
-    if ( m_data->keyboard->hasKey( keyCode ) )
+    if ( qskHasKey( m_data->keyboard, keyCode ) )
     {
         // animating the corresponding key button ???
         Q_EMIT keySelected( keyCode );
@@ -31,7 +31,10 @@ class QSK_EXPORT QskInputPanelBox : public QskBox
     enum PanelHint
     {
         InputProxy = 1 << 0,
-        Prediction = 1 << 1
+        Prediction = 1 << 1,
+
+        // QskSimpleVirtualKeyboard instead of QskVirtualKeyboard
+        SimpleKeyboard = 1 << 2
     };
 
     Q_ENUM( PanelHint )
@@ -70,6 +73,8 @@ class QSK_EXPORT QskInputPanelBox : public QskBox
     void keyPressEvent( QKeyEvent* ) override;
 
   private:
+    void updateKeyboard();
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
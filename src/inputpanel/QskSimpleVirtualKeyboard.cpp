@@ -0,0 +1,300 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskSimpleVirtualKeyboard.h"
+#include "QskVirtualKeyboardLayout.h"
+#include "QskEvent.h"
+
+#include <qbasictimer.h>
+#include <qevent.h>
+#include <qguiapplication.h>
+#include <qstylehints.h>
+
+using namespace QskVirtualKeyboardLayout;
+
+QSK_SUBCONTROL( QskSimpleVirtualKeyboard, Panel )
+QSK_SUBCONTROL( QskSimpleVirtualKeyboard, ButtonPanel )
+QSK_SUBCONTROL( QskSimpleVirtualKeyboard, ButtonText )
+
+class QskSimpleVirtualKeyboard::PrivateData
+{
+  public:
+    inline int keyAt( int index ) const
+    {
+        const auto& keyCodes = ( *currentLayout )[ mode ];
+        return keyCodes.data[ index / ColumnCount ][ index % ColumnCount ];
+    }
+
+    const Layout* currentLayout = nullptr;
+    QskVirtualKeyboard::Mode mode = QskVirtualKeyboard::LowercaseMode;
+
+    QSet< int > keyCodes;
+
+    // precalculated for all modes
+    QRectF keyRects[ QskVirtualKeyboard::ModeCount ][ KeyCount ];
+    QString keyTexts[ QskVirtualKeyboard::ModeCount ][ KeyCount ];
+
+    int pressedIndex = -1;
+    QBasicTimer repeatTimer;
+};
+
+QskSimpleVirtualKeyboard::QskSimpleVirtualKeyboard( QQuickItem* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData )
+{
+    setPolishOnResize( true );
+    initSizePolicy( QskSizePolicy::Expanding, QskSizePolicy::Constrained );
+
+    setAcceptedMouseButtons( Qt::LeftButton );
+
+    connect( this, &QskControl::localeChanged,
+        this, &QskSimpleVirtualKeyboard::updateLocale );
+
+    updateLocale( locale() );
+}
+
+QskSimpleVirtualKeyboard::~QskSimpleVirtualKeyboard()
+{
+}
+
+QskAspect::Subcontrol QskSimpleVirtualKeyboard::effectiveSubcontrol(
+    QskAspect::Subcontrol subControl ) const
+{
+    // sharing the hints of QskVirtualKeyboard
+
+    if ( subControl == Panel )
+        return QskVirtualKeyboard::Panel;
+
+    if ( subControl == ButtonPanel )
+        return QskVirtualKeyboard::ButtonPanel;
+
+    if ( subControl == ButtonText )
+        return QskVirtualKeyboard::ButtonText;
+
+    return subControl;
+}
+
+void QskSimpleVirtualKeyboard::setMode( QskVirtualKeyboard::Mode mode )
+{
+    if ( mode < 0 || mode >= QskVirtualKeyboard::ModeCount )
+        return;
+
+    if ( mode == m_data->mode )
+        return;
+
+    m_data->mode = mode;
+
+    /*
+        The geometries of all modes are already known and
+        we only need to update the nodes.
+     */
+    setPressedKeyIndex( -1 );
+    update();
+
+    Q_EMIT modeChanged( m_data->mode );
+}
+
+QskVirtualKeyboard::Mode QskSimpleVirtualKeyboard::mode() const
+{
+    return m_data->mode;
+}
+
+void QskSimpleVirtualKeyboard::updateLocale( const QLocale& locale )
+{
+    const auto newLayout = QskVirtualKeyboardLayout::layout( locale );
+
+    if ( newLayout != m_data->currentLayout )
+    {
+        m_data->currentLayout = newLayout;
+        m_data->keyCodes = QskVirtualKeyboardLayout::keyCodes( *newLayout );
+
+        for ( int mode = 0; mode < QskVirtualKeyboard::ModeCount; mode++ )
+        {
+            const auto& keyCodes = ( *newLayout )[ mode ];
+
+            for ( int i = 0; i < KeyCount; i++ )
+            {
+                const int key = keyCodes.data[ i / ColumnCount ][ i % ColumnCount ];
+
+                m_data->keyTexts[ mode ][ i ] =
+                    ( key != 0 ) ? textForKey( key ) : QString();
+            }
+        }
+
+        setMode( QskVirtualKeyboard::LowercaseMode );
+
+        setPressedKeyIndex( -1 );
+        polish();
+    }
+}
+
+bool QskSimpleVirtualKeyboard::hasKey( int keyCode ) const
+{
+    return m_data->keyCodes.contains( keyCode );
+}
+
+int QskSimpleVirtualKeyboard::keyCount() const
+{
+    return KeyCount;
+}
+
+int QskSimpleVirtualKeyboard::keyAt( int index ) const
+{
+    if ( index < 0 || index >= KeyCount )
+        return 0;
+
+    return m_data->keyAt( index );
+}
+
+QString QskSimpleVirtualKeyboard::keyTextAt( int index ) const
+{
+    if ( index < 0 || index >= KeyCount )
+        return QString();
+
+    return m_data->keyTexts[ m_data->mode ][ index ];
+}
+
+QRectF QskSimpleVirtualKeyboard::keyRectAt( int index ) const
+{
+    if ( index < 0 || index >= KeyCount )
+        return QRectF();
+
+    return m_data->keyRects[ m_data->mode ][ index ];
+}
+
+int QskSimpleVirtualKeyboard::keyIndexAt( const QPointF& pos ) const
+{
+    const auto& rects = m_data->keyRects[ m_data->mode ];
+
+    for ( int i = 0; i < KeyCount; i++ )
+    {
+        if ( rects[ i ].contains( pos ) )
+            return i;
+    }
+
+    return -1;
+}
+
+int QskSimpleVirtualKeyboard::pressedKeyIndex() const
+{
+    return m_data->pressedIndex;
+}
+
+void QskSimpleVirtualKeyboard::setPressedKeyIndex( int index )
+{
+    if ( index == m_data->pressedIndex )
+        return;
+
+    m_data->pressedIndex = index;
+    m_data->repeatTimer.stop();
+
+    if ( index >= 0 && isAutorepeat( m_data->keyAt( index ) ) )
+        m_data->repeatTimer.start( 500, this );
+
+    update();
+}
+
+void QskSimpleVirtualKeyboard::triggerKey( int index )
+{
+    const int key = m_data->keyAt( index );
+
+    const auto mode = switchedMode( m_data->mode, key );
+
+    if ( mode != QskVirtualKeyboard::CurrentMode )
+        setMode( mode );
+    else
+        Q_EMIT keySelected( key );
+}
+
+bool QskSimpleVirtualKeyboard::event( QEvent* event )
+{
+    if ( event->type() == QskEvent::WindowChange )
+    {
+        // we won't get the release for a pending press
+        setPressedKeyIndex( -1 );
+    }
+
+    return Inherited::event( event );
+}
+
+void QskSimpleVirtualKeyboard::mousePressEvent( QMouseEvent* event )
+{
+    const int index = keyIndexAt( qskMousePosition( event ) );
+    if ( index < 0 )
+    {
+        event->ignore();
+        return;
+    }
+
+    setPressedKeyIndex( index );
+    triggerKey( index );
+}
+
+void QskSimpleVirtualKeyboard::mouseMoveEvent( QMouseEvent* event )
+{
+    const auto index = m_data->pressedIndex;
+
+    if ( index >= 0 )
+    {
+        const auto& rect = m_data->keyRects[ m_data->mode ][ index ];
+        if ( !rect.contains( qskMousePosition( event ) ) )
+            setPressedKeyIndex( -1 );
+    }
+
+    event->accept();
+}
+
+void QskSimpleVirtualKeyboard::mouseReleaseEvent( QMouseEvent* )
+{
+    setPressedKeyIndex( -1 );
+}
+
+void QskSimpleVirtualKeyboard::mouseUngrabEvent()
+{
+    setPressedKeyIndex( -1 );
+}
+
+void QskSimpleVirtualKeyboard::timerEvent( QTimerEvent* event )
+{
+    if ( event->timerId() == m_data->repeatTimer.timerId() )
+    {
+        if ( m_data->pressedIndex >= 0 )
+        {
+            triggerKey( m_data->pressedIndex );
+
+            const auto interval =
+                1000 / QGuiApplication::styleHints()->keyboardAutoRepeatRate();
+
+            m_data->repeatTimer.start( interval, this );
+        }
+        else
+        {
+            m_data->repeatTimer.stop();
+        }
+
+        return;
+    }
+
+    Inherited::timerEvent( event );
+}
+
+void QskSimpleVirtualKeyboard::updateLayout()
+{
+    const auto r = subControlContentsRect( Panel );
+    if ( r.isEmpty() )
+        return;
+
+    const auto spacing = spacingHint( Panel );
+
+    for ( int mode = 0; mode < QskVirtualKeyboard::ModeCount; mode++ )
+    {
+        layoutKeys( ( *m_data->currentLayout )[ mode ],
+            r, spacing, m_data->keyRects[ mode ] );
+    }
+
+    update();
+}
+
+#include "moc_QskSimpleVirtualKeyboard.cpp"
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_SIMPLE_VIRTUAL_KEYBOARD_H
+#define QSK_SIMPLE_VIRTUAL_KEYBOARD_H
+
+#include "QskControl.h"
+#include "QskVirtualKeyboard.h"
+
+/*
+    QskSimpleVirtualKeyboard offers the same keys as QskVirtualKeyboard,
+    but without creating a button for each of them. All keys are
+    rendered by the skinlet and hit testing is done by the keyboard itself.
+
+    The geometries of the keys are calculated for all modes in advance,
+    so that switching the mode does not require any relayouting.
+ */
+class QSK_EXPORT QskSimpleVirtualKeyboard : public QskControl
+{
+    Q_OBJECT
+
+    using Inherited = QskControl;
+
+  public:
+    QSK_SUBCONTROLS( Panel, ButtonPanel, ButtonText )
+
+    QskSimpleVirtualKeyboard( QQuickItem* parent = nullptr );
+    ~QskSimpleVirtualKeyboard() override;
+
+    void setMode( QskVirtualKeyboard::Mode );
+    QskVirtualKeyboard::Mode mode() const;
+
+    void updateLocale( const QLocale& );
+
+    QskAspect::Subcontrol effectiveSubcontrol(
+        QskAspect::Subcontrol ) const override;
+
+    bool hasKey( int keyCode ) const;
+
+    // keys of the current mode
+    int keyCount() const;
+
+    int keyAt( int index ) const;
+    QString keyTextAt( int index ) const;
+    QRectF keyRectAt( int index ) const;
+
+    int keyIndexAt( const QPointF& ) const;
+    int pressedKeyIndex() const;
+
+  Q_SIGNALS:
+    void modeChanged( QskVirtualKeyboard::Mode );
+    void keySelected( int keyCode );
+
+  protected:
+    bool event( QEvent* ) override;
+
+    void mousePressEvent( QMouseEvent* ) override;
+    void mouseMoveEvent( QMouseEvent* ) override;
+    void mouseReleaseEvent( QMouseEvent* ) override;
+    void mouseUngrabEvent() override;
+
+    void timerEvent( QTimerEvent* ) override;
+
+    void updateLayout() override;
+
+  private:
+    void setPressedKeyIndex( int );
+    void triggerKey( int index );
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
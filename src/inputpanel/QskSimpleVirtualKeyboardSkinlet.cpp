@@ -0,0 +1,308 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskSimpleVirtualKeyboardSkinlet.h"
+#include "QskSimpleVirtualKeyboard.h"
+
+#include "QskAbstractButton.h"
+#include "QskBoxBorderColors.h"
+#include "QskBoxBorderMetrics.h"
+#include "QskBoxNode.h"
+#include "QskBoxShapeMetrics.h"
+#include "QskGradient.h"
+#include "QskSGNode.h"
+#include "QskTextColors.h"
+#include "QskTextNode.h"
+#include "QskTextOptions.h"
+
+#include <qfont.h>
+
+namespace
+{
+    /*
+        All keys share the same hints, so we resolve them only once
+        for the normal and once for the pressed state instead of
+        doing the lookups for each key.
+     */
+
+    class BoxHints
+    {
+      public:
+        BoxHints( const QskSkinnable* skinnable, QskAspect aspect )
+            : margins( skinnable->marginHint( aspect ) )
+            , shape( skinnable->boxShapeHint( aspect ) )
+            , borderMetrics( skinnable->boxBorderMetricsHint( aspect ) )
+            , borderColors( skinnable->boxBorderColorsHint( aspect ) )
+            , gradient( skinnable->gradientHint( aspect ) )
+        {
+        }
+
+        inline bool isVisible() const
+        {
+            if ( gradient.isVisible() )
+                return true;
+
+            return !borderMetrics.isNull() && borderColors.isVisible();
+        }
+
+        const QMarginsF margins;
+        const QskBoxShapeMetrics shape;
+        const QskBoxBorderMetrics borderMetrics;
+        const QskBoxBorderColors borderColors;
+        const QskGradient gradient;
+    };
+
+    class TextHints
+    {
+      public:
+        TextHints( const QskSkinnable* skinnable, QskAspect aspect )
+            : font( skinnable->effectiveFont( aspect ) )
+            , alignment( skinnable->alignmentHint( aspect, Qt::AlignCenter ) )
+            , textStyle( Qsk::Normal )
+        {
+            QskSkinHintStatus status;
+
+            colors.textColor = skinnable->color( aspect, &status );
+            if ( !status.isValid() )
+                colors.textColor = skinnable->color( aspect | QskAspect::TextColor );
+
+            colors.styleColor = skinnable->color( aspect | QskAspect::StyleColor );
+            colors.linkColor = skinnable->color( aspect | QskAspect::LinkColor );
+
+            if ( colors.styleColor.alpha() == 0 )
+            {
+                textStyle = skinnable->flagHint< Qsk::TextStyle >(
+                    aspect | QskAspect::Style, Qsk::Normal );
+            }
+        }
+
+        QFont font;
+        const Qt::Alignment alignment;
+
+        QskTextColors colors;
+        Qsk::TextStyle textStyle;
+    };
+}
+
+static inline QskAspect qskKeyAspect( const QskSkinnable* skinnable,
+    QskAspect::Subcontrol subControl, bool pressed )
+{
+    QskAspect aspect( subControl );
+    aspect.setState( skinnable->skinState() );
+
+    if ( pressed )
+        aspect.addState( QskAbstractButton::Pressed );
+
+    return aspect;
+}
+
+QskSimpleVirtualKeyboardSkinlet::QskSimpleVirtualKeyboardSkinlet( QskSkin* skin )
+    : Inherited( skin )
+{
+    /*
+        The boxes of all keys are in one subtree and the texts in another,
+        so that the boxes, sharing the same material, are not interleaved
+        with text nodes and can be batched by the scene graph renderer.
+     */
+    setNodeRoles( { PanelRole, ButtonsRole, TextsRole } );
+}
+
+QskSimpleVirtualKeyboardSkinlet::~QskSimpleVirtualKeyboardSkinlet() = default;
+
+QRectF QskSimpleVirtualKeyboardSkinlet::subControlRect( const QskSkinnable* skinnable,
+    const QRectF& contentsRect, QskAspect::Subcontrol subControl ) const
+{
+    if ( subControl == QskSimpleVirtualKeyboard::Panel )
+        return contentsRect;
+
+    return Inherited::subControlRect( skinnable, contentsRect, subControl );
+}
+
+QSGNode* QskSimpleVirtualKeyboardSkinlet::updateSubNode(
+    const QskSkinnable* skinnable, quint8 nodeRole, QSGNode* node ) const
+{
+    const auto keyboard = static_cast< const QskSimpleVirtualKeyboard* >( skinnable );
+
+    switch ( nodeRole )
+    {
+        case PanelRole:
+        {
+            return updateBoxNode( keyboard, node, QskSimpleVirtualKeyboard::Panel );
+        }
+
+        case ButtonsRole:
+        {
+            return updateButtonsNode( keyboard, node );
+        }
+
+        case TextsRole:
+        {
+            return updateTextsNode( keyboard, node );
+        }
+    }
+
+    return Inherited::updateSubNode( skinnable, nodeRole, node );
+}
+
+QSGNode* QskSimpleVirtualKeyboardSkinlet::updateButtonsNode(
+    const QskSimpleVirtualKeyboard* keyboard, QSGNode* node ) const
+{
+    using Q = QskSimpleVirtualKeyboard;
+
+    const BoxHints hints( keyboard, qskKeyAspect( keyboard, Q::ButtonPanel, false ) );
+
+    const int pressedIndex = keyboard->pressedKeyIndex();
+
+    std::unique_ptr< BoxHints > pressedHints;
+    if ( pressedIndex >= 0 )
+    {
+        pressedHints.reset( new BoxHints( keyboard,
+            qskKeyAspect( keyboard, Q::ButtonPanel, true ) ) );
+    }
+
+    auto keysNode = node ? node : new QSGNode();
+
+    QSGNode* lastNode = nullptr;
+
+    for ( int i = 0; i < keyboard->keyCount(); i++ )
+    {
+        const auto& h = ( i == pressedIndex ) ? *pressedHints : hints;
+        if ( !h.isVisible() )
+            continue;
+
+        const auto rect = keyboard->keyRectAt( i ).marginsRemoved( h.margins );
+        if ( rect.isEmpty() )
+            continue;
+
+        auto boxNode = static_cast< QskBoxNode* >(
+            lastNode ? lastNode->nextSibling() : keysNode->firstChild() );
+
+        if ( boxNode == nullptr )
+        {
+            boxNode = new QskBoxNode();
+            keysNode->appendChildNode( boxNode );
+        }
+
+        boxNode->setBoxData( rect, h.shape.toAbsolute( rect.size() ),
+            h.borderMetrics.toAbsolute( rect.size() ), h.borderColors, h.gradient );
+
+        lastNode = boxNode;
+    }
+
+    if ( lastNode == nullptr )
+    {
+        if ( node == nullptr )
+            delete keysNode;
+
+        return nullptr;
+    }
+
+    QskSGNode::removeAllChildNodesAfter( keysNode, lastNode );
+
+    return keysNode;
+}
+
+QSGNode* QskSimpleVirtualKeyboardSkinlet::updateTextsNode(
+    const QskSimpleVirtualKeyboard* keyboard, QSGNode* node ) const
+{
+    using Q = QskSimpleVirtualKeyboard;
+
+    const int pressedIndex = keyboard->pressedKeyIndex();
+
+    TextHints hints( keyboard, qskKeyAspect( keyboard, Q::ButtonText, false ) );
+
+    std::unique_ptr< TextHints > pressedHints;
+    if ( pressedIndex >= 0 )
+    {
+        pressedHints.reset( new TextHints( keyboard,
+            qskKeyAspect( keyboard, Q::ButtonText, true ) ) );
+    }
+
+    QskTextOptions options;
+    options.setFontSizeMode( QskTextOptions::VerticalFit );
+
+    auto keysNode = node ? node : new QSGNode();
+
+    QSGNode* lastNode = nullptr;
+
+    for ( int i = 0; i < keyboard->keyCount(); i++ )
+    {
+        const auto text = keyboard->keyTextAt( i );
+        const auto rect = keyboard->keyRectAt( i );
+
+        if ( text.isEmpty() || rect.isEmpty() )
+            continue;
+
+        auto& h = ( i == pressedIndex ) ? *pressedHints : hints;
+
+        // see QskSkinlet::updateTextNode for QskTextOptions::VerticalFit
+        h.font.setPixelSize( static_cast< int >( rect.height() * 0.5 ) );
+
+        auto textNode = static_cast< QskTextNode* >(
+            lastNode ? lastNode->nextSibling() : keysNode->firstChild() );
+
+        if ( textNode == nullptr )
+        {
+            textNode = new QskTextNode();
+            keysNode->appendChildNode( textNode );
+        }
+
+        textNode->setTextData( keyboard, text, rect, h.font,
+            options, h.colors, h.alignment, h.textStyle );
+
+        lastNode = textNode;
+    }
+
+    if ( lastNode == nullptr )
+    {
+        if ( node == nullptr )
+            delete keysNode;
+
+        return nullptr;
+    }
+
+    QskSGNode::removeAllChildNodesAfter( keysNode, lastNode );
+
+    return keysNode;
+}
+
+QSizeF QskSimpleVirtualKeyboardSkinlet::sizeHint( const QskSkinnable* skinnable,
+    Qt::SizeHint which, const QSizeF& constraint ) const
+{
+    if ( which != Qt::PreferredSize )
+        return QSizeF();
+
+    using Q = QskSimpleVirtualKeyboard;
+
+    // the same aspect ratio as QskVirtualKeyboard
+    constexpr qreal ratio = 5.0 / 12.0;
+
+    qreal w = constraint.width();
+    qreal h = constraint.height();
+
+    if ( h >= 0 )
+    {
+        const auto padding = skinnable->innerPadding( Q::Panel, QSizeF( h, h ) );
+        const auto dw = padding.left() + padding.right();
+        const auto dh = padding.top() + padding.bottom();
+
+        w = ( h - dh ) / ratio + dw;
+    }
+    else
+    {
+        if ( w < 0 )
+            w = 600;
+
+        const auto padding = skinnable->innerPadding( Q::Panel, QSizeF( w, w ) );
+        const auto dw = padding.left() + padding.right();
+        const auto dh = padding.top() + padding.bottom();
+
+        h = ( w - dw ) * ratio + dh;
+    }
+
+    return QSizeF( w, h );
+}
+
+#include "moc_QskSimpleVirtualKeyboardSkinlet.cpp"
@@ -0,0 +1,45 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_SIMPLE_VIRTUAL_KEYBOARD_SKINLET_H
+#define QSK_SIMPLE_VIRTUAL_KEYBOARD_SKINLET_H
+
+#include "QskSkinlet.h"
+
+class QskSimpleVirtualKeyboard;
+
+class QSK_EXPORT QskSimpleVirtualKeyboardSkinlet : public QskSkinlet
+{
+    Q_GADGET
+
+    using Inherited = QskSkinlet;
+
+  public:
+    enum NodeRole
+    {
+        PanelRole,
+        ButtonsRole,
+        TextsRole
+    };
+
+    Q_INVOKABLE QskSimpleVirtualKeyboardSkinlet( QskSkin* = nullptr );
+    ~QskSimpleVirtualKeyboardSkinlet() override;
+
+    QRectF subControlRect( const QskSkinnable*,
+        const QRectF&, QskAspect::Subcontrol ) const override;
+
+    QSizeF sizeHint( const QskSkinnable*,
+        Qt::SizeHint, const QSizeF& ) const override;
+
+  protected:
+    QSGNode* updateSubNode( const QskSkinnable*,
+        quint8 nodeRole, QSGNode* ) const override;
+
+  private:
+    QSGNode* updateButtonsNode( const QskSimpleVirtualKeyboard*, QSGNode* ) const;
+    QSGNode* updateTextsNode( const QskSimpleVirtualKeyboard*, QSGNode* ) const;
+};
+
+#endif
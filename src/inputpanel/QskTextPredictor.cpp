@@ -5,32 +5,317 @@
 
 #include "QskTextPredictor.h"
 
+#include <qbasictimer.h>
+#include <qcache.h>
+#include <qcoreapplication.h>
+#include <qcoreevent.h>
+#include <qmutex.h>
+#include <qrunnable.h>
+#include <qstringlist.h>
+#include <qthreadpool.h>
+#include <qwaitcondition.h>
+
+static const int qskResultEventType = QEvent::registerEventType();
+
+namespace
+{
+    class ResultEvent final : public QEvent
+    {
+      public:
+        ResultEvent( quint64 requestId,
+                const QString& text, const QStringList& candidates )
+            : QEvent( static_cast< QEvent::Type >( qskResultEventType ) )
+            , requestId( requestId )
+            , text( text )
+            , candidates( candidates )
+        {
+        }
+
+        const quint64 requestId;
+        const QString text;
+        const QStringList candidates;
+    };
+
+    /*
+        Shared between the predictor and the job being executed
+        on a worker thread, so that the job does not need to know
+        whether the predictor is still alive.
+     */
+    class Channel
+    {
+      public:
+        QMutex mutex;
+        QWaitCondition finished;
+
+        QObject* receiver = nullptr;
+        bool busy = false;
+    };
+}
+
+class QskTextPredictor::PrivateData
+{
+  public:
+    class Job final : public QRunnable
+    {
+      public:
+        Job( QskTextPredictor* predictor, const std::shared_ptr< Channel >& channel,
+                quint64 requestId, const QString& text )
+            : m_predictor( predictor )
+            , m_channel( channel )
+            , m_requestId( requestId )
+            , m_text( text )
+        {
+        }
+
+        void run() override
+        {
+            const auto candidates = m_predictor->retrieveCandidates( m_text );
+
+            QMutexLocker locker( &m_channel->mutex );
+
+            if ( m_channel->receiver )
+            {
+                QCoreApplication::postEvent( m_channel->receiver,
+                    new ResultEvent( m_requestId, m_text, candidates ) );
+            }
+
+            m_channel->busy = false;
+            m_channel->finished.wakeAll();
+        }
+
+      private:
+        QskTextPredictor* m_predictor;
+        const std::shared_ptr< Channel > m_channel;
+
+        const quint64 m_requestId;
+        const QString m_text;
+    };
+
+    PrivateData( QskTextPredictor::Attributes attributes )
+        : attributes( attributes )
+        , channel( std::make_shared< Channel >() )
+        , cache( 50 )
+    {
+    }
+
+    const QskTextPredictor::Attributes attributes;
+
+    QStringList candidates;
+
+    std::shared_ptr< Channel > channel;
+    QCache< QString, QStringList > cache;
+
+    QString text;
+    quint64 requestId = 0;
+
+    QBasicTimer debounceTimer;
+    int debounceInterval = 0;
+
+    bool asynchronous = false;
+    bool hasQueuedRequest = false;
+};
+
 QskTextPredictor::QskTextPredictor( Attributes attributes, QObject* parent )
     : QObject( parent )
-    , m_attributes( attributes )
+    , m_data( new PrivateData( attributes ) )
 {
+    m_data->channel->receiver = this;
 }
 
 QskTextPredictor::~QskTextPredictor()
 {
+    finishRequests();
+
+    QMutexLocker locker( &m_data->channel->mutex );
+    m_data->channel->receiver = nullptr;
 }
 
 QskTextPredictor::Attributes QskTextPredictor::attributes() const
 {
-    return m_attributes;
+    return m_data->attributes;
+}
+
+void QskTextPredictor::setAsynchronous( bool on )
+{
+    if ( on != m_data->asynchronous )
+    {
+        if ( !on )
+            finishRequests();
+
+        m_data->asynchronous = on;
+    }
+}
+
+bool QskTextPredictor::isAsynchronous() const
+{
+    return m_data->asynchronous;
+}
+
+void QskTextPredictor::setDebounceInterval( int ms )
+{
+    m_data->debounceInterval = qMax( ms, 0 );
+}
+
+int QskTextPredictor::debounceInterval() const
+{
+    return m_data->debounceInterval;
+}
+
+void QskTextPredictor::setCacheSize( int size )
+{
+    m_data->cache.setMaxCost( qMax( size, 0 ) );
+}
+
+int QskTextPredictor::cacheSize() const
+{
+    return m_data->cache.maxCost();
+}
+
+bool QskTextPredictor::isDeferred() const
+{
+    return m_data->asynchronous || ( m_data->debounceInterval > 0 );
+}
+
+void QskTextPredictor::request( const QString& text )
+{
+    m_data->requestId++; // outdating all pending requests
+    m_data->text = text;
+
+    if ( const auto candidates = m_data->cache.object( text ) )
+    {
+        m_data->debounceTimer.stop();
+        m_data->hasQueuedRequest = false;
+
+        setCandidates( *candidates );
+        return;
+    }
+
+    if ( m_data->debounceInterval > 0 )
+    {
+        m_data->debounceTimer.start( m_data->debounceInterval, this );
+        return;
+    }
+
+    processRequest( text );
+}
+
+void QskTextPredictor::reset()
+{
+    m_data->requestId++;
+    m_data->text.clear();
+
+    m_data->debounceTimer.stop();
+    m_data->hasQueuedRequest = false;
+
+    if ( !m_data->candidates.isEmpty() )
+    {
+        m_data->candidates.clear();
+        Q_EMIT predictionChanged();
+    }
+}
+
+int QskTextPredictor::candidateCount() const
+{
+    return m_data->candidates.count();
+}
+
+QString QskTextPredictor::candidate( int index ) const
+{
+    if ( ( index >= 0 ) && ( index < m_data->candidates.count() ) )
+        return m_data->candidates[ index ];
+
+    return QString();
 }
 
 QStringList QskTextPredictor::candidates() const
 {
-    const auto count = candidateCount();
+    return m_data->candidates;
+}
 
-    QStringList candidates;
-    candidates.reserve( count );
+void QskTextPredictor::finishRequests()
+{
+    auto channel = m_data->channel.get();
+
+    QMutexLocker locker( &channel->mutex );
+
+    while ( channel->busy )
+        channel->finished.wait( &channel->mutex );
+}
+
+void QskTextPredictor::processRequest( const QString& text )
+{
+    if ( !m_data->asynchronous )
+    {
+        const auto candidates = retrieveCandidates( text );
+        m_data->cache.insert( text, new QStringList( candidates ) );
+
+        setCandidates( candidates );
+        return;
+    }
+
+    auto channel = m_data->channel;
+
+    QMutexLocker locker( &channel->mutex );
+
+    if ( channel->busy )
+    {
+        // will be processed, when the running job has finished
+        m_data->hasQueuedRequest = true;
+        return;
+    }
+
+    channel->busy = true;
+
+    QThreadPool::globalInstance()->start(
+        new PrivateData::Job( this, channel, m_data->requestId, text ) );
+}
+
+void QskTextPredictor::setCandidates( const QStringList& candidates )
+{
+    m_data->candidates = candidates;
+    Q_EMIT predictionChanged();
+}
+
+bool QskTextPredictor::event( QEvent* event )
+{
+    if ( event->type() == qskResultEventType )
+    {
+        const auto resultEvent = static_cast< const ResultEvent* >( event );
+
+        m_data->cache.insert( resultEvent->text,
+            new QStringList( resultEvent->candidates ) );
+
+        if ( resultEvent->requestId == m_data->requestId )
+        {
+            setCandidates( resultEvent->candidates );
+        }
+        else if ( m_data->hasQueuedRequest )
+        {
+            m_data->hasQueuedRequest = false;
+
+            if ( const auto candidates = m_data->cache.object( m_data->text ) )
+                setCandidates( *candidates );
+            else
+                processRequest( m_data->text );
+        }
+
+        return true;
+    }
+
+    return Inherited::event( event );
+}
+
+void QskTextPredictor::timerEvent( QTimerEvent* event )
+{
+    if ( event->timerId() == m_data->debounceTimer.timerId() )
+    {
+        m_data->debounceTimer.stop();
+        processRequest( m_data->text );
 
-    for ( int i = 0; i < count; i++ )
-        candidates += candidate( i );
+        return;
+    }
 
-    return candidates;
+    Inherited::timerEvent( event );
 }
 
 #include "moc_QskTextPredictor.cpp"
@@ -8,13 +8,23 @@
 
 #include <QskGlobal.h>
 #include <qobject.h>
+#include <memory>
 
-// abstract base class for input methods for retrieving predictive text
+/*
+    Abstract base class for input methods for retrieving predictive text
+
+    Candidates are retrieved by retrieveCandidates(), what might
+    be expensive. QskTextPredictor offers to run the retrieval on a
+    worker thread, to debounce requests of fast typing and caches the
+    candidates of the most recent requests.
+ */
 
 class QSK_EXPORT QskTextPredictor : public QObject
 {
     Q_OBJECT
 
+    using Inherited = QObject;
+
   public:
     enum Attribute
     {
@@ -26,24 +36,63 @@ class QSK_EXPORT QskTextPredictor : public QObject
 
     ~QskTextPredictor() override;
 
-    virtual void request( const QString& text ) = 0;
-    virtual void reset() = 0;
+    void request( const QString& text );
+    void reset();
 
-    virtual int candidateCount() const = 0;
-    virtual QString candidate( int ) const = 0;
+    int candidateCount() const;
+    QString candidate( int ) const;
 
-    virtual QStringList candidates() const;
+    QStringList candidates() const;
 
     Attributes attributes() const;
 
+    /*
+        When being asynchronous retrieveCandidates() is called from
+        a worker thread. Requests are serialized and results of
+        outdated requests are not published.
+     */
+    void setAsynchronous( bool );
+    bool isAsynchronous() const;
+
+    // delay in ms, before a request is processed
+    void setDebounceInterval( int );
+    int debounceInterval() const;
+
+    // number of requests, whose candidates are cached
+    void setCacheSize( int );
+    int cacheSize() const;
+
+    // true, when the candidates are not available immediately after request()
+    bool isDeferred() const;
+
   Q_SIGNALS:
     void predictionChanged();
 
   protected:
     QskTextPredictor( Attributes, QObject* );
 
+    bool event( QEvent* ) override;
+    void timerEvent( QTimerEvent* ) override;
+
+    /*
+        Might be called from a worker thread, but never
+        concurrently for the same predictor.
+     */
+    virtual QStringList retrieveCandidates( const QString& ) = 0;
+
+    /*
+        Blocks until a running retrieval has been finished. Derived classes
+        have to call it in their destructor before releasing resources,
+        that are used in retrieveCandidates().
+     */
+    void finishRequests();
+
   private:
-    const Attributes m_attributes;
+    void processRequest( const QString& );
+    void setCandidates( const QStringList& );
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
 };
 
 #endif
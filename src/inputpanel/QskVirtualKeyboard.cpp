@@ -4,23 +4,17 @@
  *****************************************************************************/
 
 #include "QskVirtualKeyboard.h"
+#include "QskVirtualKeyboardLayout.h"
 #include "QskPushButton.h"
 #include "QskTextOptions.h"
 
 #include <qguiapplication.h>
-#include <qset.h>
 #include <qstylehints.h>
 
+using namespace QskVirtualKeyboardLayout;
+
 namespace
 {
-    enum
-    {
-        RowCount = 5,
-        ColumnCount = 12
-    };
-
-    using KeyRow = int[ ColumnCount ];
-
     class Button final : public QskPushButton
     {
       public:
@@ -59,165 +53,6 @@ namespace
     };
 }
 
-struct QskVirtualKeyboardLayouts
-{
-    struct KeyCodes
-    {
-        using Row = int[ ColumnCount ];
-        Row data[ RowCount ];
-    };
-
-    using Layout = KeyCodes[ QskVirtualKeyboard::ModeCount ];
-
-    Layout bg; // Bulgarian
-    Layout cs; // Czech
-    Layout de; // German
-    Layout da; // Danish
-    Layout el; // Greek
-    Layout en_GB; // English (GB)
-    Layout en_US; // English (US)
-    Layout es; // Spanish
-    Layout fi; // Finnish
-    Layout fr; // French
-    Layout hu; // Hungarian
-    Layout it; // Italian
-    Layout ja; // Japanese
-    Layout lv; // Latvian
-    Layout lt; // Lithuanian
-    Layout nl; // Dutch
-    Layout pt; // Portuguese
-    Layout ro; // Romanian
-    Layout ru; // Russian
-    Layout sl; // Slovene
-    Layout sk; // Slovak
-    Layout tr; // Turkish
-    Layout zh; // Chinese
-};
-
-#define LOWER( x ) int( x + 32 ) // Convert an uppercase key to lowercase
-static constexpr const QskVirtualKeyboardLayouts qskKeyboardLayouts =
-{
-#include "QskVirtualKeyboardLayouts.cpp"
-};
-#undef LOWER
-
-static qreal qskKeyStretch( int key )
-{
-    switch ( key )
-    {
-        case Qt::Key_Backspace:
-        case Qt::Key_Shift:
-        case Qt::Key_CapsLock:
-            return 1.5;
-
-        case Qt::Key_Space:
-            return 3.5;
-
-        case Qt::Key_Return:
-        case Qt::Key_Mode_switch:
-
-        // Possibly smaller
-        default:
-            break;
-    }
-
-    return 1.0;
-}
-
-static qreal qskRowStretch( const KeyRow& keyRow )
-{
-    qreal stretch = 0;
-
-    for ( const auto& key : keyRow )
-    {
-        if ( !key )
-        {
-            continue;
-        }
-
-        stretch += qskKeyStretch( key );
-    }
-
-    if ( stretch == 0.0 )
-    {
-        stretch = ColumnCount;
-    }
-
-    return stretch;
-}
-
-static QString qskTextForKey( int key )
-{
-    // Special cases
-    switch ( key )
-    {
-        case Qt::Key_Backspace:
-        case Qt::Key_Muhenkan:
-            return QChar( 0x232B );
-
-        case Qt::Key_CapsLock:
-        case Qt::Key_Kana_Lock:
-            return QChar( 0x21E7 );
-
-        case Qt::Key_Shift:
-        case Qt::Key_Kana_Shift:
-            return QChar( 0x2B06 );
-
-        case Qt::Key_Mode_switch:
-            return QChar( 0x2026 );
-
-        case Qt::Key_Return:
-        case Qt::Key_Kanji:
-            return QChar( 0x23CE );
-
-        case Qt::Key_Left:
-            return QChar( 0x2190 );
-
-        case Qt::Key_Right:
-            return QChar( 0x2192 );
-
-        case Qt::Key_ApplicationLeft:
-            return QChar( 0x2B05 );
-
-        case Qt::Key_ApplicationRight:
-            return QChar( 0x27A1 );
-
-        default:
-            return QChar( key );
-    }
-}
-
-static bool qskIsAutorepeat( int key )
-{
-    return (
-        ( key != Qt::Key_Return ) &&
-        ( key != Qt::Key_Enter ) &&
-        ( key != Qt::Key_Shift ) &&
-        ( key != Qt::Key_CapsLock ) &&
-        ( key != Qt::Key_Mode_switch ) );
-}
-
-static QSet< int > qskKeyCodes( const QskVirtualKeyboardLayouts::Layout& layout )
-{
-    QSet< int > codes;
-    codes.reserve( RowCount * ColumnCount );
-
-    for ( int mode = 0; mode <= QskVirtualKeyboard::ModeCount; mode++ )
-    {
-        const auto& keyCodes = layout[ mode ];
-
-        for ( int row = 0; row < RowCount; row++ )
-        {
-            const auto& keys = keyCodes.data[ row ];
-
-            for ( int col = 0; col < ColumnCount; col++ )
-                codes += keys[ col ];
-        }
-    }
-
-    return codes;
-}
-
 QSK_SUBCONTROL( QskVirtualKeyboard, Panel )
 QSK_SUBCONTROL( QskVirtualKeyboard, ButtonPanel )
 QSK_SUBCONTROL( QskVirtualKeyboard, ButtonText )
@@ -225,7 +60,7 @@ QSK_SUBCONTROL( QskVirtualKeyboard, ButtonText )
 class QskVirtualKeyboard::PrivateData
 {
   public:
-    const QskVirtualKeyboardLayouts::Layout* currentLayout = nullptr;
+    const Layout* currentLayout = nullptr;
     QskVirtualKeyboard::Mode mode = QskVirtualKeyboard::LowercaseMode;
 
     QVector< Button* > keyButtons;
@@ -335,56 +170,29 @@ void QskVirtualKeyboard::updateLayout()
     if ( r.isEmpty() )
         return;
 
-    const auto spacing = spacingHint( Panel );
-    const auto totalVSpacing = ( RowCount - 1 ) * spacing;
-
-    const auto keyHeight = ( r.height() - totalVSpacing ) / RowCount;
-
     const auto& keyCodes = ( *m_data->currentLayout )[ m_data->mode ];
 
-    qreal yPos = r.top();
+    QRectF rects[ KeyCount ];
+    layoutKeys( keyCodes, r, spacingHint( Panel ), rects );
 
     for ( int row = 0; row < RowCount; row++ )
     {
-        const auto& keys = keyCodes.data[ row ];
-
-#if 1
-        // there should be a better way
-        auto totalHSpacing = -spacing;
-        if ( spacing )
-        {
-            for ( int col = 0; col < ColumnCount; col++ )
-            {
-                if ( keys[ col ] != 0 )
-                    totalHSpacing += spacing;
-            }
-        }
-#endif
-        const auto baseKeyWidth = ( r.width() - totalHSpacing ) / qskRowStretch( keys );
-        qreal xPos = r.left();
-
         for ( int col = 0; col < ColumnCount; col++ )
         {
-            const int key = keys[ col ];
-            auto button = m_data->keyButtons[ row * ColumnCount + col ];
+            const int index = row * ColumnCount + col;
+
+            const int key = keyCodes.data[ row ][ col ];
+            auto button = m_data->keyButtons[ index ];
 
             button->setVisible( key != 0 );
 
             if ( button->isVisible() )
             {
-                const qreal keyWidth = baseKeyWidth * qskKeyStretch( key );
-
-                const QRectF rect( xPos, yPos, keyWidth, keyHeight );
-
-                button->setGeometry( rect );
-                button->setAutoRepeat( qskIsAutorepeat( key ) );
-                button->setText( qskTextForKey( key ) );
-
-                xPos += keyWidth + spacing;
+                button->setGeometry( rects[ index ] );
+                button->setAutoRepeat( isAutorepeat( key ) );
+                button->setText( textForKey( key ) );
             }
         }
-
-        yPos += keyHeight + spacing;
     }
 }
 
@@ -402,160 +210,22 @@ void QskVirtualKeyboard::buttonPressed()
     const auto& keyCodes = ( *m_data->currentLayout )[ m_data->mode ];
     const int key = keyCodes.data[ button->row() ][ button->column() ];
 
-    // Mode-switching keys
-    switch ( key )
-    {
-        case Qt::Key_CapsLock:
-        case Qt::Key_Kana_Lock:
-        {
-            setMode( UppercaseMode ); // Lock caps
-            break;
-        }
-
-        case Qt::Key_Shift:
-        case Qt::Key_Kana_Shift:
-        {
-            setMode( LowercaseMode ); // Unlock caps
-            break;
-        }
+    const auto mode = switchedMode( m_data->mode, key );
 
-        case Qt::Key_Mode_switch: // Cycle through modes, but skip caps
-        {
-            setMode( static_cast< QskVirtualKeyboard::Mode >(
-                m_data->mode ? ( ( m_data->mode + 1 ) % QskVirtualKeyboard::ModeCount )
-                             : SpecialCharacterMode ) );
-
-            break;
-        }
-        default:
-        {
-            Q_EMIT keySelected( key );
-        }
-    }
+    if ( mode != CurrentMode )
+        setMode( mode );
+    else
+        Q_EMIT keySelected( key );
 }
 
 void QskVirtualKeyboard::updateLocale( const QLocale& locale )
 {
-    const QskVirtualKeyboardLayouts::Layout* newLayout = nullptr;
-
-    switch ( locale.language() )
-    {
-        case QLocale::Bulgarian:
-            newLayout = &qskKeyboardLayouts.bg;
-            break;
-
-        case QLocale::Czech:
-            newLayout = &qskKeyboardLayouts.cs;
-            break;
-
-        case QLocale::German:
-            newLayout = &qskKeyboardLayouts.de;
-            break;
-
-        case QLocale::Danish:
-            newLayout = &qskKeyboardLayouts.da;
-            break;
-
-        case QLocale::Greek:
-            newLayout = &qskKeyboardLayouts.el;
-            break;
-
-        case QLocale::English:
-        {
-            switch ( locale.country() )
-            {
-                case QLocale::Canada:
-                case QLocale::UnitedStates:
-                case QLocale::UnitedStatesMinorOutlyingIslands:
-                case QLocale::UnitedStatesVirginIslands:
-                    newLayout = &qskKeyboardLayouts.en_US;
-                    break;
-
-                default:
-                    newLayout = &qskKeyboardLayouts.en_GB;
-                    break;
-            }
-
-            break;
-        }
-
-        case QLocale::Spanish:
-            newLayout = &qskKeyboardLayouts.es;
-            break;
-
-        case QLocale::Finnish:
-            newLayout = &qskKeyboardLayouts.fi;
-            break;
-
-        case QLocale::French:
-            newLayout = &qskKeyboardLayouts.fr;
-            break;
-
-        case QLocale::Hungarian:
-            newLayout = &qskKeyboardLayouts.hu;
-            break;
-
-        case QLocale::Italian:
-            newLayout = &qskKeyboardLayouts.it;
-            break;
-
-        case QLocale::Japanese:
-            newLayout = &qskKeyboardLayouts.ja;
-            break;
-
-        case QLocale::Latvian:
-            newLayout = &qskKeyboardLayouts.lv;
-            break;
-
-        case QLocale::Lithuanian:
-            newLayout = &qskKeyboardLayouts.lt;
-            break;
-
-        case QLocale::Dutch:
-            newLayout = &qskKeyboardLayouts.nl;
-            break;
-
-        case QLocale::Portuguese:
-            newLayout = &qskKeyboardLayouts.pt;
-            break;
-
-        case QLocale::Romanian:
-            newLayout = &qskKeyboardLayouts.ro;
-            break;
-
-        case QLocale::Russian:
-            newLayout = &qskKeyboardLayouts.ru;
-            break;
-
-        case QLocale::Slovenian:
-            newLayout = &qskKeyboardLayouts.sl;
-            break;
-
-        case QLocale::Slovak:
-            newLayout = &qskKeyboardLayouts.sk;
-            break;
-
-        case QLocale::Turkish:
-            newLayout = &qskKeyboardLayouts.tr;
-            break;
-
-        case QLocale::Chinese:
-            newLayout = &qskKeyboardLayouts.zh;
-            break;
-#if 1
-        case QLocale::C:
-            newLayout = &qskKeyboardLayouts.en_US;
-            break;
-#endif
-        default:
-            qWarning() << "QskVirtualKeyboard: unsupported locale:" << locale;
-            newLayout = &qskKeyboardLayouts.en_US;
-    }
+    const auto newLayout = QskVirtualKeyboardLayout::layout( locale );
 
     if ( newLayout != m_data->currentLayout )
     {
         m_data->currentLayout = newLayout;
-        m_data->keyCodes = qskKeyCodes( *newLayout );
+        m_data->keyCodes = QskVirtualKeyboardLayout::keyCodes( *newLayout );
 
         setMode( LowercaseMode );
         polish();
@@ -0,0 +1,330 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskVirtualKeyboardLayout.h"
+
+#include <qdebug.h>
+#include <qlocale.h>
+
+using namespace QskVirtualKeyboardLayout;
+
+struct QskVirtualKeyboardLayouts
+{
+    Layout bg; // Bulgarian
+    Layout cs; // Czech
+    Layout de; // German
+    Layout da; // Danish
+    Layout el; // Greek
+    Layout en_GB; // English (GB)
+    Layout en_US; // English (US)
+    Layout es; // Spanish
+    Layout fi; // Finnish
+    Layout fr; // French
+    Layout hu; // Hungarian
+    Layout it; // Italian
+    Layout ja; // Japanese
+    Layout lv; // Latvian
+    Layout lt; // Lithuanian
+    Layout nl; // Dutch
+    Layout pt; // Portuguese
+    Layout ro; // Romanian
+    Layout ru; // Russian
+    Layout sl; // Slovene
+    Layout sk; // Slovak
+    Layout tr; // Turkish
+    Layout zh; // Chinese
+};
+
+#define LOWER( x ) int( x + 32 ) // Convert an uppercase key to lowercase
+static constexpr const QskVirtualKeyboardLayouts qskKeyboardLayouts =
+{
+#include "QskVirtualKeyboardLayouts.cpp"
+};
+#undef LOWER
+
+static qreal qskRowStretch( const KeyRow& keyRow )
+{
+    qreal stretch = 0;
+
+    for ( const auto& key : keyRow )
+    {
+        if ( !key )
+        {
+            continue;
+        }
+
+        stretch += keyStretch( key );
+    }
+
+    if ( stretch == 0.0 )
+    {
+        stretch = ColumnCount;
+    }
+
+    return stretch;
+}
+
+const Layout* QskVirtualKeyboardLayout::layout( const QLocale& locale )
+{
+    switch ( locale.language() )
+    {
+        case QLocale::Bulgarian:
+            return &qskKeyboardLayouts.bg;
+
+        case QLocale::Czech:
+            return &qskKeyboardLayouts.cs;
+
+        case QLocale::German:
+            return &qskKeyboardLayouts.de;
+
+        case QLocale::Danish:
+            return &qskKeyboardLayouts.da;
+
+        case QLocale::Greek:
+            return &qskKeyboardLayouts.el;
+
+        case QLocale::English:
+        {
+            switch ( locale.country() )
+            {
+                case QLocale::Canada:
+                case QLocale::UnitedStates:
+                case QLocale::UnitedStatesMinorOutlyingIslands:
+                case QLocale::UnitedStatesVirginIslands:
+                    return &qskKeyboardLayouts.en_US;
+
+                default:
+                    return &qskKeyboardLayouts.en_GB;
+            }
+        }
+
+        case QLocale::Spanish:
+            return &qskKeyboardLayouts.es;
+
+        case QLocale::Finnish:
+            return &qskKeyboardLayouts.fi;
+
+        case QLocale::French:
+            return &qskKeyboardLayouts.fr;
+
+        case QLocale::Hungarian:
+            return &qskKeyboardLayouts.hu;
+
+        case QLocale::Italian:
+            return &qskKeyboardLayouts.it;
+
+        case QLocale::Japanese:
+            return &qskKeyboardLayouts.ja;
+
+        case QLocale::Latvian:
+            return &qskKeyboardLayouts.lv;
+
+        case QLocale::Lithuanian:
+            return &qskKeyboardLayouts.lt;
+
+        case QLocale::Dutch:
+            return &qskKeyboardLayouts.nl;
+
+        case QLocale::Portuguese:
+            return &qskKeyboardLayouts.pt;
+
+        case QLocale::Romanian:
+            return &qskKeyboardLayouts.ro;
+
+        case QLocale::Russian:
+            return &qskKeyboardLayouts.ru;
+
+        case QLocale::Slovenian:
+            return &qskKeyboardLayouts.sl;
+
+        case QLocale::Slovak:
+            return &qskKeyboardLayouts.sk;
+
+        case QLocale::Turkish:
+            return &qskKeyboardLayouts.tr;
+
+        case QLocale::Chinese:
+            return &qskKeyboardLayouts.zh;
+#if 1
+        case QLocale::C:
+            return &qskKeyboardLayouts.en_US;
+#endif
+        default:
+            qWarning() << "QskVirtualKeyboard: unsupported locale:" << locale;
+            return &qskKeyboardLayouts.en_US;
+    }
+}
+
+QSet< int > QskVirtualKeyboardLayout::keyCodes( const Layout& layout )
+{
+    QSet< int > codes;
+    codes.reserve( KeyCount );
+
+    for ( int mode = 0; mode < QskVirtualKeyboard::ModeCount; mode++ )
+    {
+        const auto& keyCodes = layout[ mode ];
+
+        for ( int row = 0; row < RowCount; row++ )
+        {
+            const auto& keys = keyCodes.data[ row ];
+
+            for ( int col = 0; col < ColumnCount; col++ )
+                codes += keys[ col ];
+        }
+    }
+
+    return codes;
+}
+
+qreal QskVirtualKeyboardLayout::keyStretch( int key )
+{
+    switch ( key )
+    {
+        case Qt::Key_Backspace:
+        case Qt::Key_Shift:
+        case Qt::Key_CapsLock:
+            return 1.5;
+
+        case Qt::Key_Space:
+            return 3.5;
+
+        case Qt::Key_Return:
+        case Qt::Key_Mode_switch:
+
+        // Possibly smaller
+        default:
+            break;
+    }
+
+    return 1.0;
+}
+
+QString QskVirtualKeyboardLayout::textForKey( int key )
+{
+    // Special cases
+    switch ( key )
+    {
+        case Qt::Key_Backspace:
+        case Qt::Key_Muhenkan:
+            return QChar( 0x232B );
+
+        case Qt::Key_CapsLock:
+        case Qt::Key_Kana_Lock:
+            return QChar( 0x21E7 );
+
+        case Qt::Key_Shift:
+        case Qt::Key_Kana_Shift:
+            return QChar( 0x2B06 );
+
+        case Qt::Key_Mode_switch:
+            return QChar( 0x2026 );
+
+        case Qt::Key_Return:
+        case Qt::Key_Kanji:
+            return QChar( 0x23CE );
+
+        case Qt::Key_Left:
+            return QChar( 0x2190 );
+
+        case Qt::Key_Right:
+            return QChar( 0x2192 );
+
+        case Qt::Key_ApplicationLeft:
+            return QChar( 0x2B05 );
+
+        case Qt::Key_ApplicationRight:
+            return QChar( 0x27A1 );
+
+        default:
+            return QChar( key );
+    }
+}
+
+bool QskVirtualKeyboardLayout::isAutorepeat( int key )
+{
+    return (
+        ( key != Qt::Key_Return ) &&
+        ( key != Qt::Key_Enter ) &&
+        ( key != Qt::Key_Shift ) &&
+        ( key != Qt::Key_CapsLock ) &&
+        ( key != Qt::Key_Mode_switch ) );
+}
+
+QskVirtualKeyboard::Mode QskVirtualKeyboardLayout::switchedMode(
+    QskVirtualKeyboard::Mode mode, int key )
+{
+    switch ( key )
+    {
+        case Qt::Key_CapsLock:
+        case Qt::Key_Kana_Lock:
+        {
+            return QskVirtualKeyboard::UppercaseMode; // Lock caps
+        }
+
+        case Qt::Key_Shift:
+        case Qt::Key_Kana_Shift:
+        {
+            return QskVirtualKeyboard::LowercaseMode; // Unlock caps
+        }
+
+        case Qt::Key_Mode_switch: // Cycle through modes, but skip caps
+        {
+            return static_cast< QskVirtualKeyboard::Mode >(
+                mode ? ( ( mode + 1 ) % QskVirtualKeyboard::ModeCount )
+                     : QskVirtualKeyboard::SpecialCharacterMode );
+        }
+    }
+
+    return QskVirtualKeyboard::CurrentMode;
+}
+
+void QskVirtualKeyboardLayout::layoutKeys( const KeyCodes& keyCodes,
+    const QRectF& rect, qreal spacing, QRectF rects[ KeyCount ] )
+{
+    const auto totalVSpacing = ( RowCount - 1 ) * spacing;
+    const auto keyHeight = ( rect.height() - totalVSpacing ) / RowCount;
+
+    qreal yPos = rect.top();
+
+    for ( int row = 0; row < RowCount; row++ )
+    {
+        const auto& keys = keyCodes.data[ row ];
+
+#if 1
+        // there should be a better way
+        auto totalHSpacing = -spacing;
+        if ( spacing )
+        {
+            for ( int col = 0; col < ColumnCount; col++ )
+            {
+                if ( keys[ col ] != 0 )
+                    totalHSpacing += spacing;
+            }
+        }
+#endif
+        const auto baseKeyWidth = ( rect.width() - totalHSpacing ) / qskRowStretch( keys );
+        qreal xPos = rect.left();
+
+        for ( int col = 0; col < ColumnCount; col++ )
+        {
+            const int key = keys[ col ];
+            auto& keyRect = rects[ row * ColumnCount + col ];
+
+            if ( key != 0 )
+            {
+                const qreal keyWidth = baseKeyWidth * keyStretch( key );
+                keyRect = QRectF( xPos, yPos, keyWidth, keyHeight );
+
+                xPos += keyWidth + spacing;
+            }
+            else
+            {
+                keyRect = QRectF();
+            }
+        }
+
+        yPos += keyHeight + spacing;
+    }
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_VIRTUAL_KEYBOARD_LAYOUT_H
+#define QSK_VIRTUAL_KEYBOARD_LAYOUT_H
+
+#include "QskVirtualKeyboard.h"
+
+#include <qrect.h>
+#include <qset.h>
+
+class QLocale;
+
+/*
+    Key codes and key geometries, that are shared between
+    QskVirtualKeyboard and QskSimpleVirtualKeyboard
+ */
+namespace QskVirtualKeyboardLayout
+{
+    enum
+    {
+        RowCount = 5,
+        ColumnCount = 12,
+        KeyCount = RowCount * ColumnCount
+    };
+
+    using KeyRow = int[ ColumnCount ];
+
+    struct KeyCodes
+    {
+        using Row = KeyRow;
+        Row data[ RowCount ];
+    };
+
+    using Layout = KeyCodes[ QskVirtualKeyboard::ModeCount ];
+
+    const Layout* layout( const QLocale& );
+    QSet< int > keyCodes( const Layout& );
+
+    qreal keyStretch( int key );
+    QString textForKey( int key );
+    bool isAutorepeat( int key );
+
+    /*
+        The mode, that is activated by a key, or
+        QskVirtualKeyboard::CurrentMode for all other keys
+     */
+    QskVirtualKeyboard::Mode switchedMode( QskVirtualKeyboard::Mode, int key );
+
+    /*
+        Calculates the geometries of all KeyCount keys. The
+        rectangles of unused keys are invalid.
+     */
+    void layoutKeys( const KeyCodes&,
+        const QRectF&, qreal spacing, QRectF rects[ KeyCount ] );
+}
+
+#endif
@@ -10,14 +10,40 @@
 
 #include <QPointer>
 
+#include <qbasictimer.h>
+#include <qelapsedtimer.h>
+
 class QskStackBox::PrivateData
 {
   public:
-    QVector< QQuickItem* > items;
+    PrivateData()
+    {
+        clock.start();
+    }
+
+    class Page
+    {
+      public:
+        ItemFactory factory;
+        qint64 hiddenAt = -1;
+    };
+
+    inline bool isUnloadable( int index ) const
+    {
+        return items[ index ] && pages[ index ].factory;
+    }
+
+    QVector< QQuickItem* > items; // nullptr for pages not being loaded
+    QVector< Page > pages;
+
     QPointer< QskStackBoxAnimator > animator;
 
     int currentIndex = -1;
     Qt::Alignment defaultAlignment = Qt::AlignLeft | Qt::AlignVCenter;
+
+    int unloadTimeout = 0;
+    QBasicTimer unloadTimer;
+    QElapsedTimer clock;
 };
 
 QskStackBox::QskStackBox( QQuickItem* parent )
@@ -102,6 +128,138 @@ QQuickItem* QskStackBox::itemAtIndex( int index ) const
     return m_data->items.value( index );
 }
 
+bool QskStackBox::isItemLoaded( int index ) const
+{
+    return m_data->items.value( index ) != nullptr;
+}
+
+QQuickItem* QskStackBox::loadItemAt( int index )
+{
+    if ( index < 0 || index >= m_data->items.count() )
+        return nullptr;
+
+    auto item = m_data->items[ index ];
+
+    if ( item == nullptr )
+    {
+        const auto& factory = m_data->pages[ index ].factory;
+        if ( factory == nullptr )
+            return nullptr;
+
+        item = factory();
+        if ( item == nullptr )
+            return nullptr;
+
+        reparentItem( item );
+
+        if ( qskIsTransparentForPositioner( item ) )
+            qskSetTransparentForPositioner( item, false );
+
+        item->setVisible( false );
+
+        m_data->items[ index ] = item;
+
+        if ( index != m_data->currentIndex )
+            setItemHidden( index );
+
+        resetImplicitSize();
+    }
+
+    return item;
+}
+
+void QskStackBox::setUnloadTimeout( int ms )
+{
+    ms = qMax( ms, 0 );
+
+    if ( ms != m_data->unloadTimeout )
+    {
+        m_data->unloadTimeout = ms;
+        m_data->unloadTimer.stop();
+
+        unloadIdleItems();
+    }
+}
+
+int QskStackBox::unloadTimeout() const
+{
+    return m_data->unloadTimeout;
+}
+
+void QskStackBox::setItemHidden( int index )
+{
+    if ( index < 0 || !m_data->isUnloadable( index ) )
+        return;
+
+    m_data->pages[ index ].hiddenAt = m_data->clock.elapsed();
+
+    if ( m_data->unloadTimeout > 0 && !m_data->unloadTimer.isActive() )
+        m_data->unloadTimer.start( m_data->unloadTimeout, this );
+}
+
+void QskStackBox::prefetchItems( int index )
+{
+    /*
+        The neighbours are the most likely targets of the next
+        transition, so we create them in advance to avoid having
+        a delay, when starting the animation.
+     */
+    loadItemAt( index - 1 );
+    loadItemAt( index + 1 );
+}
+
+void QskStackBox::unloadIdleItems()
+{
+    const int timeout = m_data->unloadTimeout;
+    if ( timeout <= 0 )
+        return;
+
+    const auto animator = m_data->animator.data();
+    const bool isAnimating = animator && animator->isRunning();
+
+    const auto now = m_data->clock.elapsed();
+
+    qint64 delay = -1;
+    bool hasUnloaded = false;
+
+    for ( int i = 0; i < m_data->items.count(); i++ )
+    {
+        if ( i == m_data->currentIndex || !m_data->isUnloadable( i ) )
+            continue;
+
+        if ( isAnimating && ( i == animator->startIndex() ) )
+        {
+            delay = timeout;
+            continue;
+        }
+
+        const auto age = now - m_data->pages[ i ].hiddenAt;
+
+        if ( age >= timeout )
+        {
+            auto item = m_data->items[ i ];
+            m_data->items[ i ] = nullptr;
+
+            unparentItem( item );
+            delete item;
+
+            hasUnloaded = true;
+        }
+        else
+        {
+            const auto remaining = timeout - age;
+            if ( delay < 0 || remaining < delay )
+                delay = remaining;
+        }
+    }
+
+    if ( delay >= 0 )
+        m_data->unloadTimer.start( static_cast< int >( delay ), this );
+
+    if ( hasUnloaded )
+        resetImplicitSize();
+}
+
 int QskStackBox::indexOf( const QQuickItem* item ) const
 {
     if ( item && ( item->parentItem() == this ) )
@@ -142,6 +300,8 @@ void QskStackBox::setCurrentIndex( int index )
     if ( animator )
         animator->stop();
 
+    loadItemAt( index );
+
     if ( window() && isVisible() && isInitiallyPainted() && animator )
     {
         // start the animation
@@ -149,6 +309,8 @@ void QskStackBox::setCurrentIndex( int index )
         animator->setEndIndex( index );
         animator->setWindow( window() );
         animator->start();
+
+        prefetchItems( index );
     }
     else
     {
@@ -162,6 +324,8 @@ void QskStackBox::setCurrentIndex( int index )
             item2->setVisible( true );
     }
 
+    setItemHidden( m_data->currentIndex );
+
     m_data->currentIndex = index;
     polish();
 
@@ -198,6 +362,8 @@ void QskStackBox::insertItem( int index, QQuickItem* item )
 
     const bool doAppend = ( index < 0 ) || ( index >= itemCount() );
 
+    PrivateData::Page page;
+
     if ( item->parentItem() == this )
     {
         const int oldIndex = indexOf( item );
@@ -212,6 +378,7 @@ void QskStackBox::insertItem( int index, QQuickItem* item )
             }
 
             m_data->items.removeAt( oldIndex );
+            page = m_data->pages.takeAt( oldIndex );
         }
     }
 
@@ -219,6 +386,7 @@ void QskStackBox::insertItem( int index, QQuickItem* item )
         index = itemCount();
 
     m_data->items.insert( index, item );
+    m_data->pages.insert( index, page );
 
     const int oldCurrentIndex = m_data->currentIndex;
 
@@ -251,6 +419,43 @@ void QskStackBox::insertItem(
     insertItem( index, item );
 }
 
+void QskStackBox::addItem( const ItemFactory& factory )
+{
+    insertItem( -1, factory );
+}
+
+void QskStackBox::insertItem( int index, const ItemFactory& factory )
+{
+    if ( factory == nullptr )
+        return;
+
+    if ( ( index < 0 ) || ( index >= itemCount() ) )
+        index = itemCount();
+
+    PrivateData::Page page;
+    page.factory = factory;
+
+    m_data->items.insert( index, nullptr );
+    m_data->pages.insert( index, page );
+
+    if ( m_data->items.count() == 1 )
+    {
+        m_data->currentIndex = 0;
+
+        if ( auto item = loadItemAt( 0 ) )
+            item->setVisible( true );
+
+        Q_EMIT currentIndexChanged( m_data->currentIndex );
+    }
+    else if ( index <= m_data->currentIndex )
+    {
+        m_data->currentIndex++;
+        Q_EMIT currentIndexChanged( m_data->currentIndex );
+    }
+
+    polish();
+}
+
 void QskStackBox::removeAt( int index )
 {
     removeItemInternal( index, true );
@@ -264,10 +469,17 @@ void QskStackBox::removeItemInternal( int index, bool unparent )
     if ( unparent )
     {
         if ( auto item = m_data->items[ index ] )
+        {
             unparentItem( item );
+
+            // items created from a factory are owned by the box
+            if ( m_data->pages[ index ].factory && item->parent() == this )
+                delete item;
+        }
     }
 
     m_data->items.removeAt( index );
+    m_data->pages.removeAt( index );
 
     auto& currentIndex = m_data->currentIndex;
 
@@ -279,7 +491,10 @@ void QskStackBox::removeItemInternal( int index, bool unparent )
             currentIndex = 0;
 
         if ( currentIndex >= 0 )
-            m_data->items[ currentIndex ]->setVisible( true );
+        {
+            if ( auto item = loadItemAt( currentIndex ) )
+                item->setVisible( true );
+        }
 
         Q_EMIT currentIndexChanged( currentIndex );
     }
@@ -305,15 +520,23 @@ void QskStackBox::autoRemoveItem( QQuickItem* item )
 
 void QskStackBox::clear( bool autoDelete )
 {
-    for ( const auto item : qskAsConst( m_data->items ) )
+    for ( int i = 0; i < m_data->items.count(); i++ )
     {
-        if( autoDelete && ( item->parent() == this ) )
+        const auto item = m_data->items[ i ];
+        if ( item == nullptr )
+            continue;
+
+        const bool isOwned = autoDelete || m_data->pages[ i ].factory;
+
+        if( isOwned && ( item->parent() == this ) )
             delete item;
         else
             item->setParentItem( nullptr );
     }
 
     m_data->items.clear();
+    m_data->pages.clear();
+    m_data->unloadTimer.stop();
 
     if ( m_data->currentIndex >= 0 )
     {
@@ -351,8 +574,8 @@ void QskStackBox::updateLayout()
 
     if ( index >= 0 )
     {
-        const auto rect = geometryForItemAt( index );
-        qskSetItemGeometry( m_data->items[ index ], rect );
+        if ( auto item = m_data->items[ index ] )
+            qskSetItemGeometry( item, geometryForItemAt( index ) );
     }
 }
 
@@ -370,7 +593,12 @@ QSizeF QskStackBox::layoutSizeHint(
         /*
             We ignore the retainSizeWhenVisible flag and include all
             invisible items. Maybe we should offer a flag to control this ?
+
+            Pages, that have not been loaded yet, can't be included.
          */
+        if ( item == nullptr )
+            continue;
+
         const auto policy = qskSizePolicy( item );
 
         if ( constraint.width() >= 0.0 && policy.isConstrained( Qt::Vertical ) )
@@ -417,6 +645,19 @@ bool QskStackBox::event( QEvent* event )
     return Inherited::event( event );
 }
 
+void QskStackBox::timerEvent( QTimerEvent* event )
+{
+    if ( event->timerId() == m_data->unloadTimer.timerId() )
+    {
+        m_data->unloadTimer.stop();
+        unloadIdleItems();
+
+        return;
+    }
+
+    Inherited::timerEvent( event );
+}
+
 void QskStackBox::dump() const
 {
     auto debug = qDebug();
@@ -435,6 +676,12 @@ void QskStackBox::dump() const
 
         debug << "  " << i << ": ";
 
+        if ( item == nullptr )
+        {
+            debug << "[not loaded]\n";
+            continue;
+        }
+
         const auto constraint = qskSizeConstraint( item, Qt::PreferredSize );
         debug << item->metaObject()->className()
             <<  " w:" << constraint.width() << " h:" << constraint.height();
@@ -7,6 +7,7 @@
 #define QSK_STACK_BOX_H
 
 #include "QskIndexedLayoutBox.h"
+#include <functional>
 
 class QskStackBoxAnimator;
 
@@ -23,6 +24,8 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
     using Inherited = QskBox;
 
   public:
+    using ItemFactory = std::function< QQuickItem*() >;
+
     explicit QskStackBox( QQuickItem* parent = nullptr );
     QskStackBox( bool autoAddChildren, QQuickItem* parent = nullptr );
 
@@ -40,6 +43,20 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
     void insertItem( int index, QQuickItem* );
     void insertItem( int index, QQuickItem*, Qt::Alignment );
 
+    /*
+        Pages, that are created from a factory, when being shown
+        for the first time. Those items are owned by the box.
+     */
+    void addItem( const ItemFactory& );
+    void insertItem( int index, const ItemFactory& );
+
+    bool isItemLoaded( int index ) const;
+    QQuickItem* loadItemAt( int index );
+
+    // 0: never unload pages created from a factory
+    void setUnloadTimeout( int ms );
+    int unloadTimeout() const;
+
     void removeItem( const QQuickItem* );
     void removeAt( int index );
 
@@ -71,6 +88,7 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
 
   protected:
     bool event( QEvent* ) override;
+    void timerEvent( QTimerEvent* ) override;
     void updateLayout() override;
 
     QSizeF layoutSizeHint( Qt::SizeHint, const QSizeF& ) const override;
@@ -83,6 +101,10 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
 
     void removeItemInternal( int index, bool unparent );
 
+    void prefetchItems( int index );
+    void unloadIdleItems();
+    void setItemHidden( int index );
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
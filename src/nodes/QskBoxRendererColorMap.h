@@ -237,7 +237,7 @@ namespace QskVertex
     ColoredLine* fillOrdered( ContourIterator& contourIt,
         qreal value1, qreal value2, const QskGradient& gradient, ColoredLine* line )
     {
-        if ( gradient.stops().size() == 2 )
+        if ( gradient.stopCount() == 2 )
         {
             if ( value2 == 1.0 && value1 == 0.0 )
             {
@@ -778,7 +778,7 @@ static inline int qskFillLineCount(
     // adding vertexes for the stops - beside the first/last
 
     if ( !gradient.isMonochrome() )
-        lineCount += gradient.stops().size() - 2;
+        lineCount += gradient.stopCount() - 2;
 
     return lineCount;
 }
@@ -1176,7 +1176,7 @@ void QskBoxRenderer::renderRectellipse( const QRectF& rect,
         {
             // degenerated to a rectangle
 
-            fillLineCount = gradient.stops().count();
+            fillLineCount = gradient.stopCount();
 
 #if 1
             // code copied from QskBoxRendererRect.cpp TODO ...
@@ -1237,7 +1237,7 @@ void QskBoxRenderer::renderRectellipse( const QRectF& rect,
         }
         else if ( !gradient.isMonochrome() )
         {
-            if ( gradient.stops().count() > 2 ||
+            if ( gradient.stopCount() > 2 ||
                 gradient.orientation() == QskGradient::Diagonal )
             {
                 fillRandom = false;
@@ -498,7 +498,7 @@ void QskBoxRenderer::renderRect(
     int fillLineCount = 0;
     if ( !in.isEmpty() )
     {
-        fillLineCount = gradient.stops().count();
+        fillLineCount = gradient.stopCount();
 
         if ( gradient.orientation() == QskGradient::Diagonal )
         {
@@ -558,7 +558,7 @@ void QskBoxRenderer::renderRect(
         }
         else
         {
-            bool fillRandom = gd.stops().count() <= 2;
+            bool fillRandom = gd.stopCount() <= 2;
             if ( fillRandom )
             {
                 /*
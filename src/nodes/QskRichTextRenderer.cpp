@@ -7,17 +7,36 @@
 #include "QskTextColors.h"
 #include "QskTextOptions.h"
 
-#include <qglobalstatic.h>
-#include <qmutex.h>
-#include <qthread.h>
+#include <qcache.h>
+#include <qtextdocument.h>
+#include <qtextobject.h>
+#include <qthreadstorage.h>
 
 class QQuickWindow;
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquicktext_p.h>
 #include <private/qquicktext_p_p.h>
+#include <private/qsgadaptationlayer_p.h>
 QSK_QT_PRIVATE_END
 
+/*
+    Glyph nodes of texts without any color related markup, so that
+    their colors can be changed without having to rebuild the nodes.
+    The bits 0xff00 are used for the node roles ( QskSGNode ), so we
+    use one of the bits, that are unused by QSGNode.
+ */
+#define RecolorableFlag static_cast< QSGNode::Flag >( 0x100000 )
+
+static inline bool qskIsUniformlyColored( const QTextCharFormat& format )
+{
+    return !( format.hasProperty( QTextFormat::ForegroundBrush )
+        || format.hasProperty( QTextFormat::BackgroundBrush )
+        || format.isAnchor() || format.isImageFormat()
+        || format.fontUnderline() || format.fontOverline()
+        || format.fontStrikeOut() );
+}
+
 // Since Qt 5.7 QQuickTextNode is public and could be used TODO ...
 
 namespace
@@ -113,6 +132,52 @@ namespace
             return QQuickTextPrivate::get( that )->layedOutTextRect;
         }
 
+        bool isUniformlyColored() const
+        {
+            /*
+                Texts, where all glyphs are in the text color and no
+                other nodes than glyph nodes are involved
+             */
+            auto d = QQuickTextPrivate::get( const_cast< TextItem* >( this ) );
+
+            if ( d->extra.isAllocated() && !d->extra->imgTags.isEmpty() )
+                return false;
+
+            if ( d->extra.isAllocated() && d->extra->doc )
+            {
+                const auto doc = d->extra->doc;
+
+                if ( !doc->rootFrame()->childFrames().isEmpty() )
+                    return false; // tables
+
+                for ( auto block = doc->begin(); block.isValid(); block = block.next() )
+                {
+                    if ( block.textList() || block.blockFormat().hasProperty(
+                        QTextFormat::BlockTrailingHorizontalRulerWidth ) )
+                    {
+                        return false;
+                    }
+
+                    for ( auto it = block.begin(); !it.atEnd(); ++it )
+                    {
+                        if ( !qskIsUniformlyColored( it.fragment().charFormat() ) )
+                            return false;
+                    }
+                }
+
+                return true;
+            }
+
+            // StyledText
+            for ( const auto& range : d->layout.formats() )
+            {
+                if ( !qskIsUniformlyColored( range.format ) )
+                    return false;
+            }
+
+            return true;
+        }
+
         void updateTextNode( QQuickWindow* window, QSGNode* parentNode )
         {
             QQuickItemPrivate::get( this )->refWindow( window );
@@ -121,8 +186,20 @@ namespace
                 delete parentNode->firstChild();
 
             auto node = QQuickText::updatePaintNode( nullptr, nullptr );
-            node->reparentChildNodesTo( parentNode );
-            delete node;
+            if ( node )
+            {
+                node->reparentChildNodesTo( parentNode );
+                delete node;
+
+                if ( isUniformlyColored() )
+                {
+                    for ( auto child = parentNode->firstChild();
+                        child != nullptr; child = child->nextSibling() )
+                    {
+                        child->setFlag( RecolorableFlag, true );
+                    }
+                }
+            }
 
             QQuickItemPrivate::get( this )->derefWindow();
         }
@@ -135,58 +212,89 @@ namespace
         }
     };
 
-    class TextItemMap
+    class LayoutKey
     {
       public:
-        ~TextItemMap()
+        inline LayoutKey( const QString& text, const QFont& font,
+                const QskTextOptions& options, const QSizeF& size )
+            : text( text )
+            , font( font )
+            , options( options )
+            , size( size )
         {
-            qDeleteAll( m_hash );
         }
 
-        inline TextItem* item()
+        inline bool operator==( const LayoutKey& other ) const
         {
-            const auto thread = QThread::currentThread();
-
-            QMutexLocker locker( &m_mutex );
+            return ( size == other.size ) && ( options == other.options )
+                && ( text == other.text ) && ( font == other.font );
+        }
 
-            auto it = m_hash.constFind( thread );
-            if ( it == m_hash.constEnd() )
-            {
-                auto textItem = new TextItem();
-                QObject::connect( thread, &QThread::finished,
-                    textItem, [ this, thread ] { removeItem( thread ); } );
+        const QString text;
+        const QFont font;
+        const QskTextOptions options;
+        const QSizeF size;
+    };
 
-                m_hash.insert( thread, textItem );
-                return textItem;
-            }
+    inline uint qHash( const LayoutKey& key, uint seed = 0 )
+    {
+        uint hash = qHash( key.text, seed );
+        hash = qHash( key.font, hash );
+        hash = qHash( key.options, hash );
+        hash = qHashBits( &key.size, sizeof( QSizeF ), hash );
 
-            return it.value();
-        }
+        return hash;
+    }
 
-      private:
-        void removeItem( const QThread* thread )
+    class TextContext
+    {
+      public:
+        TextContext()
+            : sizes( 100 )
+            , rects( 100 )
         {
-            auto textItem = m_hash.take( thread );
-            if ( textItem )
-                textItem->deleteLater();
         }
 
-        QMutex m_mutex;
-        QHash< const QThread*, TextItem* > m_hash;
+        TextItem item;
+
+        // parsing and layouting rich text is expensive
+        QCache< LayoutKey, QSizeF > sizes;
+        QCache< LayoutKey, QRectF > rects;
     };
 }
 
 /*
     size requests and rendering might be from different threads and we
     better use different items as we might end up in events internally
-    being sent, that leads to crashes because of it
+    being sent, that leads to crashes because of it.
+
+    As each thread has its own item and caches, no locking is necessary.
  */
-Q_GLOBAL_STATIC( TextItemMap, qskTextItemMap )
+static QThreadStorage< TextContext* > qskTextContexts;
+
+static inline TextContext* qskTextContext()
+{
+    auto context = qskTextContexts.localData();
+    if ( context == nullptr )
+    {
+        // deleted by QThreadStorage, when the thread finishes
+        context = new TextContext();
+        qskTextContexts.setLocalData( context );
+    }
+
+    return context;
+}
 
 QSizeF QskRichTextRenderer::textSize(
     const QString& text, const QFont& font, const QskTextOptions& options )
 {
-    auto& textItem = *qskTextItemMap->item();
+    auto context = qskTextContext();
+
+    const LayoutKey key( text, font, options, QSizeF() );
+    if ( const auto size = context->sizes.object( key ) )
+        return *size;
+
+    auto& textItem = context->item;
 
     textItem.begin();
 
@@ -202,6 +310,8 @@ QSizeF QskRichTextRenderer::textSize(
 
     textItem.reset();
 
+    context->sizes.insert( key, new QSizeF( sz ) );
+
     return sz;
 }
 
@@ -209,7 +319,13 @@ QRectF QskRichTextRenderer::textRect(
     const QString& text, const QFont& font,
     const QskTextOptions& options, const QSizeF& size )
 {
-    auto& textItem = *qskTextItemMap->item();
+    auto context = qskTextContext();
+
+    const LayoutKey key( text, font, options, size );
+    if ( const auto rect = context->rects.object( key ) )
+        return *rect;
+
+    auto& textItem = context->item;
 
     textItem.begin();
 
@@ -228,6 +344,8 @@ QRectF QskRichTextRenderer::textRect(
 
     textItem.reset();
 
+    context->rects.insert( key, new QRectF( rect ) );
+
     return rect;
 }
 
@@ -240,7 +358,7 @@ void QskRichTextRenderer::updateNode(
     // are we killing internal caches of QQuickText, when always using
     // the same item for the creation the text nodes. TODO ...
 
-    auto& textItem = *qskTextItemMap->item();
+    auto& textItem = qskTextContext()->item;
 
     textItem.begin();
 
@@ -286,3 +404,27 @@ void QskRichTextRenderer::updateNode(
     textItem.updateTextNode( item->window(), node );
     textItem.reset();
 }
+
+bool QskRichTextRenderer::updateNodeColor( QSGNode* parentNode,
+    const QskTextColors& colors, Qsk::TextStyle style )
+{
+    for ( auto node = parentNode->firstChild();
+        node != nullptr; node = node->nextSibling() )
+    {
+        if ( !( node->flags() & RecolorableFlag ) )
+            return false;
+    }
+
+    for ( auto node = parentNode->firstChild();
+        node != nullptr; node = node->nextSibling() )
+    {
+        auto glyphNode = static_cast< QSGGlyphNode* >( node );
+
+        glyphNode->setColor( colors.textColor );
+        glyphNode->setStyle( static_cast< QQuickText::TextStyle >( style ) );
+        glyphNode->setStyleColor( colors.styleColor );
+        glyphNode->update();
+    }
+
+    return true;
+}
@@ -17,6 +17,7 @@ class QFont;
 class QRectF;
 class QSizeF;
 class QQuickItem;
+class QSGNode;
 class QSGTransformNode;
 
 namespace QskRichTextRenderer
@@ -26,6 +27,9 @@ namespace QskRichTextRenderer
         Qsk::TextStyle, const QskTextColors&, Qt::Alignment,
         const QRectF&, const QQuickItem*, QSGTransformNode* );
 
+    // false, when the colors can't be changed without rebuilding the nodes
+    QSK_EXPORT bool updateNodeColor( QSGNode*, const QskTextColors&, Qsk::TextStyle );
+
     QSK_EXPORT QSizeF textSize(
         const QString&, const QFont&, const QskTextOptions& );
 
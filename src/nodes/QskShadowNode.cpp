@@ -0,0 +1,510 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskShadowNode.h"
+#include "QskBoxShapeMetrics.h"
+#include "QskShadowMetrics.h"
+
+#include <qcolor.h>
+#include <qhash.h>
+#include <qimage.h>
+#include <qmath.h>
+#include <qmutex.h>
+#include <qpainter.h>
+#include <qpainterpath.h>
+#include <qquickwindow.h>
+#include <qsgimagenode.h>
+#include <qsgtexture.h>
+
+namespace
+{
+    class TextureKey
+    {
+      public:
+        inline bool operator==( const TextureKey& other ) const
+        {
+            for ( int i = 0; i < 4; i++ )
+            {
+                if ( radii[ i ] != other.radii[ i ] )
+                    return false;
+            }
+
+            return ( blurRadius == other.blurRadius )
+                && ( color == other.color ) && ( devicePixelRatio == other.devicePixelRatio );
+        }
+
+        inline bool operator!=( const TextureKey& other ) const
+        {
+            return !( *this == other );
+        }
+
+        // including the spread radius
+        QSizeF radii[ 4 ];
+
+        qreal blurRadius = 0.0;
+        QRgb color = 0;
+        qreal devicePixelRatio = 1.0;
+    };
+
+    inline uint qHash( const TextureKey& key, uint seed = 0 )
+    {
+        uint hash = seed;
+
+        for ( const auto& radius : key.radii )
+        {
+            hash = ::qHash( radius.width(), hash );
+            hash = ::qHash( radius.height(), hash );
+        }
+
+        hash = ::qHash( key.blurRadius, hash );
+        hash = ::qHash( key.color, hash );
+        hash = ::qHash( key.devicePixelRatio, hash );
+
+        return hash;
+    }
+
+    class Texture
+    {
+      public:
+        QSGTexture* texture = nullptr;
+
+        int patchSize = 0;       // in pixels of the texture
+        int bandSize = 0;        // straight section between the corners
+        int refCount = 0;
+    };
+
+    /*
+        The textures are specific for the scene graph context of a
+        window, while the nodes of many cards usually share the same
+        texture. Unused textures are deleted immediately, so animating
+        a shadow does not pile up textures.
+     */
+    class TextureCache
+    {
+      public:
+        Texture* acquire( QQuickWindow*, const TextureKey& );
+        void release( QQuickWindow*, const TextureKey& );
+
+      private:
+        void invalidate( QQuickWindow*, bool isDestroyed );
+
+        QMutex m_mutex;
+        QHash< QQuickWindow*, QHash< TextureKey, Texture* > > m_textures;
+    };
+}
+
+Q_GLOBAL_STATIC( TextureCache, qskTextureCache )
+
+static void qskBoxBlur( uchar* bits, int width, int height,
+    int bytesPerLine, int radius, bool horizontal )
+{
+    const int count = horizontal ? height : width;
+    const int length = horizontal ? width : height;
+
+    const int step = horizontal ? 1 : bytesPerLine;
+    const int lineStep = horizontal ? bytesPerLine : 1;
+
+    const int size = 2 * radius + 1;
+
+    QVector< uchar > line( length );
+
+    for ( int i = 0; i < count; i++ )
+    {
+        auto p = bits + i * lineStep;
+
+        for ( int j = 0; j < length; j++ )
+            line[ j ] = p[ j * step ];
+
+        int sum = 0;
+        for ( int j = -radius; j <= radius; j++ )
+            sum += ( j >= 0 && j < length ) ? line[ j ] : 0;
+
+        for ( int j = 0; j < length; j++ )
+        {
+            p[ j * step ] = static_cast< uchar >( sum / size );
+
+            const int in = j + radius + 1;
+            const int out = j - radius;
+
+            if ( in < length )
+                sum += line[ in ];
+
+            if ( out >= 0 )
+                sum -= line[ out ];
+        }
+    }
+}
+
+static void qskBlur( QImage& image, qreal sigma )
+{
+    /*
+        3 passes of a box blur are a good approximation
+        of a gaussian blur
+     */
+    const int radius = qRound( 0.5 * ( std::sqrt( 4.0 * sigma * sigma + 1.0 ) - 1.0 ) );
+    if ( radius <= 0 )
+        return;
+
+    for ( int pass = 0; pass < 3; pass++ )
+    {
+        qskBoxBlur( image.bits(), image.width(), image.height(),
+            image.bytesPerLine(), radius, true );
+
+        qskBoxBlur( image.bits(), image.width(), image.height(),
+            image.bytesPerLine(), radius, false );
+    }
+}
+
+static QPainterPath qskShapePath( const QRectF& rect, const QSizeF radii[ 4 ] )
+{
+    const auto& tl = radii[ Qt::TopLeftCorner ];
+    const auto& tr = radii[ Qt::TopRightCorner ];
+    const auto& bl = radii[ Qt::BottomLeftCorner ];
+    const auto& br = radii[ Qt::BottomRightCorner ];
+
+    QPainterPath path;
+
+    path.moveTo( rect.left(), rect.top() + tl.height() );
+    path.arcTo( rect.left(), rect.top(), 2 * tl.width(), 2 * tl.height(), 180, -90 );
+
+    path.lineTo( rect.right() - tr.width(), rect.top() );
+    path.arcTo( rect.right() - 2 * tr.width(), rect.top(),
+        2 * tr.width(), 2 * tr.height(), 90, -90 );
+
+    path.lineTo( rect.right(), rect.bottom() - br.height() );
+    path.arcTo( rect.right() - 2 * br.width(), rect.bottom() - 2 * br.height(),
+        2 * br.width(), 2 * br.height(), 0, -90 );
+
+    path.lineTo( rect.left() + bl.width(), rect.bottom() );
+    path.arcTo( rect.left(), rect.bottom() - 2 * bl.height(),
+        2 * bl.width(), 2 * bl.height(), 270, -90 );
+
+    path.closeSubpath();
+
+    return path;
+}
+
+static QImage qskShadowImage( const TextureKey& key, int& patchSize, int& bandSize )
+{
+    /*
+        A box, that is just large enough to have the blurred corners
+        and a straight section between them, that can be stretched
+        to any size. Only the center of the section is stretched, so that
+        linear filtering never picks up pixels from the corners.
+     */
+    const qreal dpr = key.devicePixelRatio;
+    const qreal blur = key.blurRadius * dpr;
+
+    qreal maxRadius = 0.0;
+    for ( const auto& radius : key.radii )
+        maxRadius = qMax( maxRadius, qMax( radius.width(), radius.height() ) );
+
+    patchSize = qCeil( maxRadius * dpr + 2.0 * blur );
+
+    bandSize = 3;
+
+    const int size = 2 * patchSize + bandSize;
+
+    QImage alphaMap( size, size, QImage::Format_Alpha8 );
+    alphaMap.fill( 0 );
+
+    {
+        QPainter painter( &alphaMap );
+        painter.setRenderHint( QPainter::Antialiasing, true );
+        painter.setPen( Qt::NoPen );
+        painter.setBrush( Qt::black );
+        painter.scale( dpr, dpr );
+
+        const qreal b = key.blurRadius;
+        const qreal s = size / dpr;
+
+        painter.drawPath( qskShapePath(
+            QRectF( b, b, s - 2 * b, s - 2 * b ), key.radii ) );
+    }
+
+    // the blur radius follows the definition of CSS: 2 * sigma
+    qskBlur( alphaMap, 0.5 * blur );
+
+    const auto color = QColor::fromRgba( key.color );
+
+    QImage image( size, size, QImage::Format_ARGB32_Premultiplied );
+
+    for ( int y = 0; y < size; y++ )
+    {
+        const auto alphas = alphaMap.constScanLine( y );
+        auto pixels = reinterpret_cast< QRgb* >( image.scanLine( y ) );
+
+        for ( int x = 0; x < size; x++ )
+        {
+            const int a = color.alpha() * alphas[ x ] / 255;
+
+            pixels[ x ] = qPremultiply( qRgba(
+                color.red(), color.green(), color.blue(), a ) );
+        }
+    }
+
+    image.setDevicePixelRatio( dpr );
+
+    return image;
+}
+
+Texture* TextureCache::acquire( QQuickWindow* window, const TextureKey& key )
+{
+    QMutexLocker locker( &m_mutex );
+
+    if ( !m_textures.contains( window ) )
+    {
+        QObject::connect( window, &QQuickWindow::sceneGraphInvalidated,
+            window, [ this, window ] { invalidate( window, false ); },
+            Qt::DirectConnection );
+
+        QObject::connect( window, &QObject::destroyed,
+            [ this, window ] { invalidate( window, true ); } );
+    }
+
+    auto& textures = m_textures[ window ];
+
+    auto& texture = textures[ key ];
+    if ( texture == nullptr )
+    {
+        texture = new Texture();
+
+        const auto image = qskShadowImage(
+            key, texture->patchSize, texture->bandSize );
+        texture->texture = window->createTextureFromImage( image );
+    }
+
+    texture->refCount++;
+    return texture;
+}
+
+void TextureCache::release( QQuickWindow* window, const TextureKey& key )
+{
+    QMutexLocker locker( &m_mutex );
+
+    auto it = m_textures.find( window );
+    if ( it == m_textures.end() )
+        return;
+
+    auto& textures = it.value();
+
+    auto textureIt = textures.find( key );
+    if ( textureIt != textures.end() )
+    {
+        auto texture = textureIt.value();
+
+        if ( --texture->refCount <= 0 )
+        {
+            textures.erase( textureIt );
+
+            delete texture->texture;
+            delete texture;
+        }
+    }
+}
+
+void TextureCache::invalidate( QQuickWindow* window, bool isDestroyed )
+{
+    QMutexLocker locker( &m_mutex );
+
+    auto it = m_textures.find( window );
+    if ( it == m_textures.end() )
+        return;
+
+    for ( auto texture : qskAsConst( it.value() ) )
+    {
+        delete texture->texture;
+        delete texture;
+    }
+
+    if ( isDestroyed )
+        m_textures.erase( it );
+    else
+        it->clear(); // keeping the connections
+}
+
+class QskShadowNode::PrivateData
+{
+  public:
+    ~PrivateData()
+    {
+        releaseTexture();
+    }
+
+    void releaseTexture()
+    {
+        if ( texture )
+        {
+            if ( !qskTextureCache.isDestroyed() )
+                qskTextureCache->release( window, key );
+
+            texture = nullptr;
+        }
+    }
+
+    QQuickWindow* window = nullptr;
+
+    TextureKey key;
+    Texture* texture = nullptr;
+
+    QRectF rect;
+    QSGImageNode* patches[ 9 ] = {};
+};
+
+QskShadowNode::QskShadowNode()
+    : m_data( new PrivateData() )
+{
+}
+
+QskShadowNode::~QskShadowNode()
+{
+}
+
+void QskShadowNode::setShadowData( QQuickWindow* window, const QRectF& rect,
+    const QskBoxShapeMetrics& shape, const QskShadowMetrics& shadowMetrics,
+    const QColor& color )
+{
+    auto& d = *m_data;
+
+    const auto metrics = shadowMetrics.toAbsolute( rect.size() );
+    const auto blur = qMax( metrics.blurRadius(), qreal( 0.0 ) );
+
+    const auto shadowRect = metrics.shadowRect( rect ).adjusted( -blur, -blur, blur, blur );
+
+    if ( window == nullptr || !color.isValid() || color.alpha() == 0
+        || shadowRect.isEmpty() )
+    {
+        for ( auto& patch : d.patches )
+        {
+            if ( patch )
+            {
+                removeChildNode( patch );
+                delete patch;
+
+                patch = nullptr;
+            }
+        }
+
+        d.releaseTexture();
+
+        return;
+    }
+
+    TextureKey key;
+    {
+        const auto absoluteShape = shape.toAbsolute( rect.size() );
+        const auto spread = metrics.spreadRadius();
+
+        for ( int i = 0; i < 4; i++ )
+        {
+            auto radius = absoluteShape.radius( static_cast< Qt::Corner >( i ) );
+
+            if ( radius.width() > 0.0 && radius.height() > 0.0 )
+            {
+                radius.rwidth() = qMax( radius.width() + spread, qreal( 0.0 ) );
+                radius.rheight() = qMax( radius.height() + spread, qreal( 0.0 ) );
+            }
+            else
+            {
+                radius = QSizeF( 0.0, 0.0 );
+            }
+
+            key.radii[ i ] = radius;
+        }
+
+        key.blurRadius = blur;
+        key.color = color.rgba();
+        key.devicePixelRatio = window->effectiveDevicePixelRatio();
+    }
+
+    if ( d.texture && d.window == window && d.key == key && d.rect == shadowRect )
+        return;
+
+    if ( d.texture == nullptr || d.window != window || d.key != key )
+    {
+        auto texture = qskTextureCache->acquire( window, key );
+
+        d.releaseTexture();
+
+        d.window = window;
+        d.key = key;
+        d.texture = texture;
+    }
+
+    d.rect = shadowRect;
+
+    /*
+        The corners are not scaled, the straight sections in the
+        middle of the texture are stretched
+     */
+    const int n = d.texture->patchSize;
+    const int m = d.texture->bandSize;
+
+    const qreal k = n / key.devicePixelRatio;
+
+    const qreal kx = qMin( k, 0.5 * shadowRect.width() );
+    const qreal ky = qMin( k, 0.5 * shadowRect.height() );
+
+    const qreal sourceX[] = { 0.0, qreal( n ), qreal( n + m ), qreal( 2 * n + m ) };
+
+    // the stretched slice: the pixel in the middle of the straight section
+    const qreal sourceMiddle[] = { n + 0.5 * ( m - 1 ), n + 0.5 * ( m + 1 ) };
+
+    const qreal targetX[] = { shadowRect.left(), shadowRect.left() + kx,
+        shadowRect.right() - kx, shadowRect.right() };
+
+    const qreal targetY[] = { shadowRect.top(), shadowRect.top() + ky,
+        shadowRect.bottom() - ky, shadowRect.bottom() };
+
+    QSGNode* previousNode = nullptr;
+
+    for ( int row = 0; row < 3; row++ )
+    {
+        for ( int col = 0; col < 3; col++ )
+        {
+            auto& patch = d.patches[ row * 3 + col ];
+
+            const QRectF targetRect( targetX[ col ], targetY[ row ],
+                targetX[ col + 1 ] - targetX[ col ], targetY[ row + 1 ] - targetY[ row ] );
+
+            if ( targetRect.isEmpty() )
+            {
+                if ( patch )
+                {
+                    removeChildNode( patch );
+                    delete patch;
+
+                    patch = nullptr;
+                }
+
+                continue;
+            }
+
+            if ( patch == nullptr )
+            {
+                patch = window->createImageNode();
+                patch->setFiltering( QSGTexture::Linear );
+
+                if ( previousNode )
+                    insertChildNodeAfter( patch, previousNode );
+                else
+                    prependChildNode( patch );
+            }
+
+            const auto x1 = ( col == 1 ) ? sourceMiddle[ 0 ] : sourceX[ col ];
+            const auto x2 = ( col == 1 ) ? sourceMiddle[ 1 ] : sourceX[ col + 1 ];
+            const auto y1 = ( row == 1 ) ? sourceMiddle[ 0 ] : sourceX[ row ];
+            const auto y2 = ( row == 1 ) ? sourceMiddle[ 1 ] : sourceX[ row + 1 ];
+
+            const QRectF sourceRect( x1, y1, x2 - x1, y2 - y1 );
+
+            patch->setTexture( d.texture->texture );
+            patch->setSourceRect( sourceRect );
+            patch->setRect( targetRect );
+
+            previousNode = patch;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_SHADOW_NODE_H
+#define QSK_SHADOW_NODE_H
+
+#include "QskGlobal.h"
+
+#include <qsgnode.h>
+#include <memory>
+
+class QskBoxShapeMetrics;
+class QskShadowMetrics;
+class QColor;
+class QQuickWindow;
+
+/*
+    QskShadowNode draws the shadow of a box as a nine-patch: the blurred
+    corners and edges are rasterized once into a small texture, that
+    is shared by all nodes of a window with the same shape, shadow and color.
+    The patches are QSGImageNodes, so the node works with all
+    scene graph backends - including the software renderer.
+ */
+class QSK_EXPORT QskShadowNode : public QSGNode
+{
+  public:
+    QskShadowNode();
+    ~QskShadowNode() override;
+
+    void setShadowData( QQuickWindow*, const QRectF& rect,
+        const QskBoxShapeMetrics&, const QskShadowMetrics&, const QColor& );
+
+  private:
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
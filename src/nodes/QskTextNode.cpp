@@ -13,8 +13,7 @@
 
 static inline uint qskHash(
     const QString& text, const QSizeF& size, const QFont& font,
-    const QskTextOptions& options, const QskTextColors& colors,
-    Qt::Alignment alignment, Qsk::TextStyle textStyle )
+    const QskTextOptions& options, Qt::Alignment alignment )
 {
     uint hash = 11000;
 
@@ -22,15 +21,20 @@ static inline uint qskHash(
     hash = qHash( font, hash );
     hash = qHash( options, hash );
     hash = qHash( alignment, hash );
-    hash = qHash( textStyle, hash );
-    hash = colors.hash( hash );
     hash = qHashBits( &size, sizeof( QSizeF ), hash );
 
     return hash;
 }
 
+static inline uint qskColorHash(
+    const QskTextColors& colors, Qsk::TextStyle textStyle )
+{
+    return colors.hash( qHash( textStyle, 11000 ) );
+}
+
 QskTextNode::QskTextNode()
     : m_hash( 0 )
+    , m_colorHash( 0 )
 {
 }
 
@@ -49,21 +53,26 @@ void QskTextNode::setTextData(
     if ( matrix != this->matrix() ) // avoid setting DirtyMatrix accidently
         setMatrix( matrix );
 
-    const uint hash = qskHash( text, rect.size(), font,
-        options, colors, alignment, textStyle );
+    const uint hash = qskHash( text, rect.size(), font, options, alignment );
+    const uint colorHash = qskColorHash( colors, textStyle );
 
-    if ( hash != m_hash )
+    if ( hash == m_hash )
     {
-        m_hash = hash;
+        if ( colorHash == m_colorHash )
+            return;
 
-        const QRectF textRect( 0, 0, rect.width(), rect.height() );
+        m_colorHash = colorHash;
 
-        /*
-            In case of having color changes only we would could
-            go a faster update path: see QskPlainTextRenderer::updateNodeColor.
-            TODO ...
-         */
-        QskTextRenderer::updateNode( text, font, options, textStyle,
-            colors, alignment, textRect, item, this );
+        // color changes only: no need to rebuild the glyph nodes
+        if ( QskTextRenderer::updateNodeColor( options, colors, textStyle, this ) )
+            return;
     }
+
+    m_hash = hash;
+    m_colorHash = colorHash;
+
+    const QRectF textRect( 0, 0, rect.width(), rect.height() );
+
+    QskTextRenderer::updateNode( text, font, options, textStyle,
+        colors, alignment, textRect, item, this );
 }
@@ -30,6 +30,7 @@ class QSK_EXPORT QskTextNode : public QSGTransformNode
 
   private:
     uint m_hash;
+    uint m_colorHash;
 };
 
 #endif
@@ -7,6 +7,7 @@
 #include "QskPlainTextRenderer.h"
 #include "QskRichTextRenderer.h"
 #include "QskTextOptions.h"
+#include "QskTextColors.h"
 
 #include <qrect.h>
 
@@ -49,3 +50,17 @@ void QskTextRenderer::updateNode(
             text, font, options, style, colors, alignment, rect, item, node );
     }
 }
+
+bool QskTextRenderer::updateNodeColor( const QskTextOptions& options,
+    const QskTextColors& colors, Qsk::TextStyle style, QSGTransformNode* node )
+{
+    if ( options.format() == QskTextOptions::PlainText )
+    {
+        QskPlainTextRenderer::updateNodeColor(
+            node, colors.textColor, style, colors.styleColor );
+
+        return true;
+    }
+
+    return QskRichTextRenderer::updateNodeColor( node, colors, style );
+}
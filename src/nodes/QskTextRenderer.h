@@ -26,6 +26,9 @@ namespace QskTextRenderer
         const QskTextColors&, Qt::Alignment, const QRectF&,
         const QQuickItem*, QSGTransformNode* );
 
+    QSK_EXPORT bool updateNodeColor( const QskTextOptions&,
+        const QskTextColors&, Qsk::TextStyle, QSGTransformNode* );
+
     QSK_EXPORT QSizeF textSize(
         const QString&, const QFont&, const QskTextOptions& );
 
@@ -0,0 +1,359 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskTiledGraphicNode.h"
+#include "QskTextureNode.h"
+#include "QskGraphic.h"
+#include "QskColorFilter.h"
+
+#include <qhash.h>
+#include <qmath.h>
+#include <qpainter.h>
+#include <qvector.h>
+
+#include <algorithm>
+
+static inline uint qskHash(
+    const QskGraphic& graphic, const QskColorFilter& colorFilter,
+    QskTextureRenderer::RenderMode renderMode )
+{
+    uint hash = 12000;
+
+    const auto& substitutions = colorFilter.substitutions();
+    if ( substitutions.size() > 0 )
+    {
+        hash = qHashBits( substitutions.constData(),
+            substitutions.size() * sizeof( substitutions[ 0 ] ), hash );
+    }
+
+    hash = graphic.hash( hash );
+    hash = qHash( renderMode, hash );
+
+    return hash;
+}
+
+static inline quint64 qskTileKey( int level, int row, int col )
+{
+    return ( quint64( quint16( level ) ) << 48 )
+        | ( quint64( row & 0xffffff ) << 24 ) | quint64( col & 0xffffff );
+}
+
+static inline QRectF qskScaledRect( const QRectF& rect, qreal sx, qreal sy )
+{
+    return QRectF( rect.x() * sx, rect.y() * sy,
+        rect.width() * sx, rect.height() * sy );
+}
+
+static QRectF qskPaintedRect( const QskGraphic& graphic, const QRectF& targetRect )
+{
+    /*
+        The area, where the graphic paints something, when being
+        rendered into targetRect. The calculation ignores the effect of
+        unscaled pens, so we add some extra pixels.
+     */
+
+    const auto pr = graphic.controlPointRect();
+    const auto br = graphic.boundingRect();
+
+    if ( pr.isEmpty() || br.isEmpty() )
+        return targetRect;
+
+    const qreal sx = targetRect.width() / pr.width();
+    const qreal sy = targetRect.height() / pr.height();
+
+    auto r = qskScaledRect( br.translated( -pr.topLeft() ), sx, sy );
+    r.translate( targetRect.topLeft() );
+
+    const qreal m = 2.0;
+    return r.adjusted( -m, -m, m, m ) & targetRect;
+}
+
+namespace
+{
+    class Tile
+    {
+      public:
+        QskTextureNode* node = nullptr;
+        quint64 usage = 0; // last update, where the tile has been visible
+    };
+
+    class TilePaintHelper : public QskTextureRenderer::PaintHelper
+    {
+      public:
+        TilePaintHelper( const QskGraphic& graphic, const QskColorFilter& filter,
+                const QRectF& levelRect, const QPointF& tilePos )
+            : m_graphic( graphic )
+            , m_filter( filter )
+            , m_levelRect( levelRect )
+            , m_tilePos( tilePos )
+        {
+        }
+
+        void paint( QPainter* painter, const QSize& size ) override
+        {
+            painter->setClipRect( 0, 0, size.width(), size.height() );
+            painter->translate( -m_tilePos );
+
+            m_graphic.render( painter, m_levelRect, m_filter, Qt::IgnoreAspectRatio );
+        }
+
+      private:
+        const QskGraphic& m_graphic;
+        const QskColorFilter& m_filter;
+        const QRectF m_levelRect;
+        const QPointF m_tilePos;
+    };
+}
+
+class QskTiledGraphicNode::PrivateData
+{
+  public:
+    ~PrivateData()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        for ( const auto& tile : qskAsConst( tiles ) )
+            delete tile.node;
+
+        tiles.clear();
+
+        delete previewNode;
+        previewNode = nullptr;
+    }
+
+    void purgeTiles()
+    {
+        if ( tiles.count() <= cacheSize )
+            return;
+
+        QVector< QPair< quint64, quint64 > > candidates;
+        candidates.reserve( tiles.count() );
+
+        for ( auto it = tiles.constBegin(); it != tiles.constEnd(); ++it )
+        {
+            if ( it->usage != usage )
+                candidates += qMakePair( it->usage, it.key() );
+        }
+
+        std::sort( candidates.begin(), candidates.end() );
+
+        for ( const auto& candidate : qskAsConst( candidates ) )
+        {
+            if ( tiles.count() <= cacheSize )
+                break;
+
+            delete tiles.take( candidate.second ).node;
+        }
+    }
+
+    int tileSize = 512;
+    int tilesPerUpdate = 4;
+    int cacheSize = 64;
+
+    uint hash = 0;
+    qreal aspectRatio = 0.0;
+
+    QHash< quint64, Tile > tiles;
+    QskTextureNode* previewNode = nullptr;
+
+    quint64 usage = 0;
+    bool isComplete = true;
+};
+
+QskTiledGraphicNode::QskTiledGraphicNode()
+    : m_data( new PrivateData() )
+{
+}
+
+QskTiledGraphicNode::~QskTiledGraphicNode()
+{
+    // the nodes are owned by the cache
+    removeAllChildNodes();
+}
+
+void QskTiledGraphicNode::setTileSize( int size )
+{
+    size = qBound( 64, size, 4096 );
+
+    if ( size != m_data->tileSize )
+    {
+        removeAllChildNodes();
+        m_data->clear();
+
+        m_data->tileSize = size;
+    }
+}
+
+int QskTiledGraphicNode::tileSize() const
+{
+    return m_data->tileSize;
+}
+
+void QskTiledGraphicNode::setTilesPerUpdate( int count )
+{
+    m_data->tilesPerUpdate = qMax( count, 1 );
+}
+
+int QskTiledGraphicNode::tilesPerUpdate() const
+{
+    return m_data->tilesPerUpdate;
+}
+
+void QskTiledGraphicNode::setCacheSize( int size )
+{
+    m_data->cacheSize = qMax( size, 0 );
+}
+
+int QskTiledGraphicNode::cacheSize() const
+{
+    return m_data->cacheSize;
+}
+
+bool QskTiledGraphicNode::isComplete() const
+{
+    return m_data->isComplete;
+}
+
+bool QskTiledGraphicNode::setGraphic( QQuickWindow* window,
+    const QskGraphic& graphic, const QskColorFilter& colorFilter,
+    QskTextureRenderer::RenderMode renderMode,
+    const QRectF& rect, const QRectF& clipRect )
+{
+    auto& d = *m_data;
+
+    removeAllChildNodes();
+
+    d.isComplete = true;
+
+    if ( graphic.isNull() || rect.isEmpty() )
+    {
+        d.clear();
+        d.hash = 0;
+
+        return true;
+    }
+
+    const auto hash = qskHash( graphic, colorFilter, renderMode );
+    const auto aspectRatio = rect.height() / rect.width();
+
+    if ( hash != d.hash || !qFuzzyCompare( aspectRatio, d.aspectRatio ) )
+    {
+        d.clear();
+
+        d.hash = hash;
+        d.aspectRatio = aspectRatio;
+    }
+
+    d.usage++;
+
+    const int ts = d.tileSize;
+
+    /*
+        The zoom levels grow by a factor of sqrt(2). The tiles of a
+        level are rasterized for the upper bound of its range,
+        so that they are never upscaled.
+     */
+    int level = qCeil( 2.0 * std::log2( rect.width() / ts ) );
+    level = qMax( level, 0 );
+
+    const qreal levelWidth = ts * std::pow( 2.0, 0.5 * level );
+    const qreal f = levelWidth / rect.width();
+
+    const QRectF levelRect( 0.0, 0.0, levelWidth, rect.height() * f );
+    const auto paintedRect = qskPaintedRect( graphic, levelRect );
+
+    const auto visibleRect = qskScaledRect(
+        ( clipRect & rect ).translated( -rect.topLeft() ), f, f ) & paintedRect;
+
+    if ( !visibleRect.isEmpty() )
+    {
+        const int col0 = qFloor( visibleRect.left() / ts );
+        const int col1 = qCeil( visibleRect.right() / ts ) - 1;
+        const int row0 = qFloor( visibleRect.top() / ts );
+        const int row1 = qCeil( visibleRect.bottom() / ts ) - 1;
+
+        int budget = d.tilesPerUpdate;
+
+        for ( int row = row0; row <= row1; row++ )
+        {
+            for ( int col = col0; col <= col1; col++ )
+            {
+                const auto tileRect = QRectF( col * ts, row * ts, ts, ts ) & levelRect;
+
+                if ( !tileRect.intersects( paintedRect ) )
+                    continue; // empty tile
+
+                const auto key = qskTileKey( level, row, col );
+                const auto targetRect = qskScaledRect(
+                    tileRect, 1.0 / f, 1.0 / f ).translated( rect.topLeft() );
+
+                auto it = d.tiles.find( key );
+                if ( it == d.tiles.end() )
+                {
+                    if ( budget <= 0 )
+                    {
+                        d.isComplete = false;
+                        continue;
+                    }
+
+                    budget--;
+
+                    const QSize textureSize( qCeil( tileRect.width() ),
+                        qCeil( tileRect.height() ) );
+
+                    TilePaintHelper helper( graphic, colorFilter,
+                        levelRect, tileRect.topLeft() );
+
+                    const auto textureId = QskTextureRenderer::createTexture(
+                        renderMode, textureSize, &helper );
+
+                    Tile tile;
+                    tile.node = new QskTextureNode();
+                    tile.node->setTexture( window, targetRect, textureId );
+
+                    it = d.tiles.insert( key, tile );
+                }
+                else
+                {
+                    auto node = it->node;
+                    node->setTexture( window, targetRect, node->textureId() );
+                }
+
+                it->usage = d.usage;
+                appendChildNode( it->node );
+            }
+        }
+    }
+
+    if ( !d.isComplete )
+    {
+        /*
+            A coarse version of the complete graphic, that is
+            visible until all tiles have been rasterized.
+         */
+        if ( d.previewNode == nullptr )
+        {
+            const auto size = QSizeF( ts, ts * aspectRatio ).toSize();
+
+            d.previewNode = new QskTextureNode();
+            d.previewNode->setTexture( window, rect,
+                QskTextureRenderer::createTextureFromGraphic( renderMode,
+                    size.expandedTo( QSize( 1, 1 ) ), graphic, colorFilter,
+                    Qt::IgnoreAspectRatio ) );
+        }
+
+        auto node = d.previewNode;
+        node->setTexture( window, rect, node->textureId() );
+
+        prependChildNode( node );
+    }
+
+    d.purgeTiles();
+
+    return d.isComplete;
+}
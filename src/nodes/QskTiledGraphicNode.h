@@ -0,0 +1,65 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_TILED_GRAPHIC_NODE_H
+#define QSK_TILED_GRAPHIC_NODE_H
+
+#include "QskTextureRenderer.h"
+
+#include <qsgnode.h>
+#include <memory>
+
+class QskGraphic;
+class QskColorFilter;
+class QQuickWindow;
+
+/*
+    QskTiledGraphicNode is an alternative for QskGraphicNode for
+    graphics, that are displayed in sizes beyond the limits of
+    a texture - f.e in zoomable views.
+
+    The graphic is rasterized into tiles of a fixed size. Only the tiles,
+    that intersect with the visible part of the graphic are created.
+    The tiles are cached for discrete zoom levels, so that zooming
+    within a level only scales the existing tiles.
+
+    A coarse preview of the complete graphic is shown for tiles, that
+    have not been rasterized yet. As rasterizing is limited to a number
+    of tiles per update, setGraphic returns false, when further updates
+    are necessary to complete the visible area.
+ */
+class QSK_EXPORT QskTiledGraphicNode : public QSGNode
+{
+  public:
+    QskTiledGraphicNode();
+    ~QskTiledGraphicNode() override;
+
+    void setTileSize( int );
+    int tileSize() const;
+
+    // number of tiles, that are rasterized in one update
+    void setTilesPerUpdate( int );
+    int tilesPerUpdate() const;
+
+    // number of tiles in the cache, including the invisible ones
+    void setCacheSize( int );
+    int cacheSize() const;
+
+    /*
+        rect: the geometry of the complete graphic
+        clipRect: the visible part of it
+     */
+    bool setGraphic( QQuickWindow*, const QskGraphic&,
+        const QskColorFilter&, QskTextureRenderer::RenderMode,
+        const QRectF& rect, const QRectF& clipRect );
+
+    bool isComplete() const;
+
+  private:
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
@@ -0,0 +1,474 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#include "QskVectorGraphicNode.h"
+#include "QskColorFilter.h"
+#include "QskGraphic.h"
+#include "QskPainterCommand.h"
+#include "QskVertex.h"
+
+#include <qglobalstatic.h>
+#include <qmath.h>
+#include <qpaintengine.h>
+#include <qpainter.h>
+#include <qpainterpath.h>
+#include <qquickwindow.h>
+#include <qsgvertexcolormaterial.h>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qpainterpath_p.h>
+#include <private/qtriangulatingstroker_p.h>
+#include <private/qtriangulator_p.h>
+QSK_QT_PRIVATE_END
+
+Q_GLOBAL_STATIC( QSGVertexColorMaterial, qskMaterialVertex )
+
+static inline uint qskColorsHash( const QskColorFilter& colorFilter )
+{
+    uint hash = 12000;
+
+    const auto& substitutions = colorFilter.substitutions();
+    if ( substitutions.size() > 0 )
+    {
+        hash = qHashBits( substitutions.constData(),
+            substitutions.size() * sizeof( substitutions[ 0 ] ), hash );
+    }
+
+    return hash;
+}
+
+static inline bool qskIsSolid( const QBrush& brush )
+{
+    return brush.style() == Qt::NoBrush || brush.style() == Qt::SolidPattern;
+}
+
+static inline QColor qskColor( QColor color, qreal opacity )
+{
+    if ( opacity < 1.0 )
+        color.setAlphaF( color.alphaF() * opacity );
+
+    return color;
+}
+
+static inline qreal qskTransformScale( const QTransform& transform )
+{
+    return qSqrt( qAbs( transform.determinant() ) );
+}
+
+namespace
+{
+    class Batch
+    {
+      public:
+        int from;
+        int count;
+
+        // the color before applying the color filter
+        QColor color;
+    };
+
+    class Tessellator
+    {
+      public:
+        Tessellator( QVector< QPointF >& points, QVector< Batch >& batches )
+            : m_points( points )
+            , m_batches( batches )
+        {
+        }
+
+        /*
+            The vertices are calculated in the coordinates of the graphic,
+            while scale is the factor, that is used for flattening curves
+            and for the widths of the pens, that are not scaled.
+         */
+        void tessellate( const QskGraphic& graphic, qreal scale )
+        {
+            m_points.clear();
+            m_batches.clear();
+
+            const bool pensUnscaled =
+                graphic.testRenderHint( QskGraphic::RenderPensUnscaled );
+
+            QPen pen;
+            QBrush brush;
+            QTransform transform;
+            qreal opacity = 1.0;
+
+            for ( const auto& command : graphic.commands() )
+            {
+                if ( command.type() == QskPainterCommand::State )
+                {
+                    const auto data = command.stateData();
+
+                    if ( data->flags & QPaintEngine::DirtyPen )
+                        pen = data->pen;
+
+                    if ( data->flags & QPaintEngine::DirtyBrush )
+                        brush = data->brush;
+
+                    if ( data->flags & QPaintEngine::DirtyTransform )
+                        transform = data->transform;
+
+                    if ( data->flags & QPaintEngine::DirtyOpacity )
+                        opacity = data->opacity;
+
+                    continue;
+                }
+
+                if ( command.type() != QskPainterCommand::Path )
+                    continue;
+
+                const auto& path = *command.path();
+                if ( path.isEmpty() )
+                    continue;
+
+                if ( brush.style() == Qt::SolidPattern )
+                {
+                    fillPath( transform.map( path ),
+                        qskColor( brush.color(), opacity ), scale );
+                }
+
+                if ( pen.style() != Qt::NoPen && pen.brush().style() == Qt::SolidPattern )
+                {
+                    const auto color = qskColor( pen.color(), opacity );
+
+                    if ( pen.isCosmetic() || pensUnscaled )
+                        strokeUnscaledPath( transform.map( path ), pen, color, scale );
+                    else
+                        strokePath( path, pen, transform, color, scale );
+                }
+            }
+        }
+
+      private:
+        void fillPath( const QPainterPath& path, const QColor& color, qreal scale )
+        {
+            const auto triangles = qTriangulate( path,
+                QTransform::fromScale( scale, scale ), 1, true );
+
+            const auto& indices = triangles.indices;
+            const auto vertices = triangles.vertices.constData();
+
+            const int from = m_points.size();
+            m_points.reserve( from + indices.size() );
+
+            for ( int i = 0; i < indices.size(); i++ )
+            {
+                int index;
+
+                if ( indices.type() == QVertexIndexVector::UnsignedInt )
+                    index = static_cast< const quint32* >( indices.data() )[ i ];
+                else
+                    index = static_cast< const quint16* >( indices.data() )[ i ];
+
+                m_points += QPointF( vertices[ 2 * index ] / scale,
+                    vertices[ 2 * index + 1 ] / scale );
+            }
+
+            addBatch( from, color );
+        }
+
+        void strokePath( const QPainterPath& path, const QPen& pen,
+            const QTransform& transform, const QColor& color, qreal scale )
+        {
+            // stroking in the coordinates of the path, as the pen is scaled
+
+            const qreal invScale = 1.0 / ( scale * qskTransformScale( transform ) );
+            stroke( path, pen, invScale, transform );
+
+            addBatch( m_points.size() - m_stroke.size(), color );
+        }
+
+        void strokeUnscaledPath( const QPainterPath& path,
+            const QPen& pen, const QColor& color, qreal scale )
+        {
+            // stroking in device coordinates, where the pen width is meant for
+
+            auto p = pen;
+            p.setCosmetic( false );
+            p.setWidthF( qMax( pen.widthF(), qreal( 1.0 ) ) );
+
+            stroke( QTransform::fromScale( scale, scale ).map( path ),
+                p, 1.0, QTransform::fromScale( 1.0 / scale, 1.0 / scale ) );
+
+            addBatch( m_points.size() - m_stroke.size(), color );
+        }
+
+        void stroke( const QPainterPath& path, const QPen& pen,
+            qreal invScale, const QTransform& transform )
+        {
+            m_stroke.clear();
+
+            const auto hints = QPainter::Antialiasing;
+            const QRectF clipRect = path.controlPointRect().adjusted(
+                -pen.widthF(), -pen.widthF(), pen.widthF(), pen.widthF() );
+
+            QTriangulatingStroker stroker;
+            stroker.setInvScale( invScale );
+
+            if ( pen.style() == Qt::SolidLine )
+            {
+                stroker.process( qtVectorPathForPath( path ), pen, clipRect, hints );
+            }
+            else
+            {
+                QDashedStrokeProcessor dashStroker;
+                dashStroker.setInvScale( invScale );
+                dashStroker.process( qtVectorPathForPath( path ), pen, clipRect, hints );
+
+                const QVectorPath dashPath( dashStroker.points(),
+                    dashStroker.elementCount(), dashStroker.elementTypes(), 0 );
+
+                stroker.process( dashPath, pen, clipRect, hints );
+            }
+
+            // the stroker creates a triangle strip
+
+            const int count = stroker.vertexCount() / 2;
+            const auto vertices = stroker.vertices();
+
+            if ( count < 3 )
+                return;
+
+            QVector< QPointF > strip;
+            strip.reserve( count );
+
+            for ( int i = 0; i < count; i++ )
+                strip += transform.map( QPointF( vertices[ 2 * i ], vertices[ 2 * i + 1 ] ) );
+
+            m_stroke.reserve( 3 * ( count - 2 ) );
+
+            for ( int i = 2; i < count; i++ )
+                m_stroke << strip[ i - 2 ] << strip[ i - 1 ] << strip[ i ];
+
+            m_points += m_stroke;
+        }
+
+        void addBatch( int from, const QColor& color )
+        {
+            const int count = m_points.size() - from;
+            if ( count <= 0 )
+                return;
+
+            if ( !m_batches.isEmpty() )
+            {
+                auto& batch = m_batches.last();
+                if ( batch.color == color )
+                {
+                    batch.count += count;
+                    return;
+                }
+            }
+
+            m_batches += { from, count, color };
+        }
+
+        QVector< QPointF >& m_points;
+        QVector< Batch >& m_batches;
+
+        QVector< QPointF > m_stroke;
+    };
+}
+
+class QskVectorGraphicNode::PrivateData
+{
+  public:
+    PrivateData()
+        : geometry( QSGGeometry::defaultAttributes_ColoredPoint2D(), 0 )
+    {
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+        geometry.setDrawingMode( QSGGeometry::DrawTriangles );
+#else
+        geometry.setDrawingMode( GL_TRIANGLES );
+#endif
+        geometry.setVertexDataPattern( QSGGeometry::StaticPattern );
+    }
+
+    QSGGeometry geometry;
+
+    // the tessellated graphic in its own coordinates
+    QVector< QPointF > points;
+    QVector< Batch > batches;
+
+    qreal scale = 0.0; // the scale of the tessellation
+    bool hasUnscaledPens = false;
+
+    uint hash = 0;
+    uint colorsHash = 0;
+
+    QTransform transform;
+};
+
+QskVectorGraphicNode::QskVectorGraphicNode()
+    : m_data( new PrivateData() )
+{
+    setGeometry( &m_data->geometry );
+    setMaterial( qskMaterialVertex );
+}
+
+QskVectorGraphicNode::~QskVectorGraphicNode()
+{
+}
+
+bool QskVectorGraphicNode::canTessellate( const QskGraphic& graphic )
+{
+    if ( graphic.commandTypes() & QskGraphic::RasterData )
+        return false;
+
+    for ( const auto& command : graphic.commands() )
+    {
+        if ( command.type() != QskPainterCommand::State )
+            continue;
+
+        const auto data = command.stateData();
+
+        if ( ( data->flags & QPaintEngine::DirtyPen ) && !qskIsSolid( data->pen.brush() ) )
+            return false;
+
+        if ( ( data->flags & QPaintEngine::DirtyBrush ) && !qskIsSolid( data->brush ) )
+            return false;
+
+        if ( ( data->flags & QPaintEngine::DirtyClipEnabled ) && data->isClipEnabled )
+            return false;
+
+        if ( data->flags & ( QPaintEngine::DirtyClipRegion | QPaintEngine::DirtyClipPath ) )
+            return false;
+
+        if ( ( data->flags & QPaintEngine::DirtyCompositionMode )
+            && data->compositionMode != QPainter::CompositionMode_SourceOver )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void QskVectorGraphicNode::setGraphic( QQuickWindow* window,
+    const QskGraphic& graphic, const QskColorFilter& colorFilter,
+    const QRectF& rect, Qt::Orientations mirrored )
+{
+    auto& d = *m_data;
+
+    /*
+        Like QskGraphicNode we expect rect to be in device pixels,
+        but with the position in item coordinates
+     */
+    const qreal ratio = window->effectiveDevicePixelRatio();
+    const QRectF targetRect( rect.x(), rect.y(),
+        rect.width() / ratio, rect.height() / ratio );
+
+    const auto br = graphic.boundingRect();
+
+    if ( br.isEmpty() || targetRect.isEmpty() )
+    {
+        if ( d.geometry.vertexCount() > 0 )
+        {
+            d.geometry.allocate( 0 );
+            markDirty( QSGNode::DirtyGeometry );
+        }
+
+        d.hash = 0;
+        return;
+    }
+
+    const qreal sx = targetRect.width() / br.width();
+    const qreal sy = targetRect.height() / br.height();
+
+    const qreal scale = qMax( sx, sy ) * ratio;
+    const auto hash = graphic.hash( 12000 );
+
+    /*
+        Curves are flattened for the scale of the tessellation.
+        As long as we are not zooming in/out too much we can
+        reuse the triangles.
+     */
+    bool tessellate = ( hash != d.hash )
+        || ( scale > 2.0 * d.scale ) || ( scale < 0.5 * d.scale );
+
+    if ( d.hasUnscaledPens && scale != d.scale )
+        tessellate = true;
+
+    if ( tessellate )
+    {
+        d.hash = hash;
+        d.scale = scale;
+
+        d.hasUnscaledPens = graphic.testRenderHint( QskGraphic::RenderPensUnscaled );
+
+        if ( !d.hasUnscaledPens )
+        {
+            for ( const auto& command : graphic.commands() )
+            {
+                if ( command.type() == QskPainterCommand::State )
+                {
+                    const auto data = command.stateData();
+
+                    if ( ( data->flags & QPaintEngine::DirtyPen ) && data->pen.isCosmetic() )
+                    {
+                        d.hasUnscaledPens = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        Tessellator tessellator( d.points, d.batches );
+        tessellator.tessellate( graphic, scale );
+    }
+
+    QTransform transform;
+
+    if ( mirrored )
+    {
+        const auto c = targetRect.center();
+
+        transform.translate( c.x(), c.y() );
+        transform.scale( ( mirrored & Qt::Horizontal ) ? -1.0 : 1.0,
+            ( mirrored & Qt::Vertical ) ? -1.0 : 1.0 );
+        transform.translate( -c.x(), -c.y() );
+    }
+
+    QTransform tr;
+    tr.translate( targetRect.x(), targetRect.y() );
+    tr.scale( sx, sy );
+    tr.translate( -br.x(), -br.y() );
+
+    transform = tr * transform;
+
+    const auto colorsHash = qskColorsHash( colorFilter );
+
+    if ( tessellate || transform != d.transform || colorsHash != d.colorsHash )
+    {
+        d.transform = transform;
+        d.colorsHash = colorsHash;
+
+        updateGeometry( colorFilter );
+    }
+}
+
+void QskVectorGraphicNode::updateGeometry( const QskColorFilter& colorFilter )
+{
+    const auto& d = *m_data;
+
+    auto& geometry = m_data->geometry;
+    geometry.allocate( d.points.size() );
+
+    auto vertexData = geometry.vertexDataAsColoredPoint2D();
+    const auto points = d.points.constData();
+
+    for ( const auto& batch : d.batches )
+    {
+        const QskVertex::Color c( colorFilter.substituted( batch.color ) );
+
+        for ( int i = batch.from; i < batch.from + batch.count; i++ )
+        {
+            const auto pos = d.transform.map( points[ i ] );
+            vertexData[ i ].set( pos.x(), pos.y(), c.r, c.g, c.b, c.a );
+        }
+    }
+
+    markDirty( QSGNode::DirtyGeometry );
+}
@@ -0,0 +1,52 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ * This file may be used under the terms of the QSkinny License, Version 1.0
+ *****************************************************************************/
+
+#ifndef QSK_VECTOR_GRAPHIC_NODE_H
+#define QSK_VECTOR_GRAPHIC_NODE_H
+
+#include "QskGlobal.h"
+
+#include <qnamespace.h>
+#include <qsgnode.h>
+#include <memory>
+
+class QskGraphic;
+class QskColorFilter;
+class QQuickWindow;
+
+/*
+    QskVectorGraphicNode is an alternative for QskGraphicNode, that
+    tessellates the paths of a graphic into colored triangles instead of
+    rasterizing it into a texture.
+
+    The tessellation is done in the coordinates of the graphic, so that
+    resizing the node only maps the vertices - as long as the scale
+    stays in the range, where the curves have been flattened accurately.
+    Changing the color filter rewrites the vertex colors only.
+
+    Only graphics with paths, that are painted with solid pens
+    and brushes can be tessellated. There is no antialiasing beside
+    what is offered by multisampling of the window.
+ */
+class QSK_EXPORT QskVectorGraphicNode : public QSGGeometryNode
+{
+  public:
+    QskVectorGraphicNode();
+    ~QskVectorGraphicNode() override;
+
+    void setGraphic( QQuickWindow*,
+        const QskGraphic&, const QskColorFilter&, const QRectF&,
+        Qt::Orientations mirrored = Qt::Orientations() );
+
+    static bool canTessellate( const QskGraphic& );
+
+  private:
+    void updateGeometry( const QskColorFilter& );
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
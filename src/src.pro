@@ -94,11 +94,14 @@ HEADERS += \
     nodes/QskRichTextRenderer.h \
     nodes/QskScaleRenderer.h \
     nodes/QskSGNode.h \
+    nodes/QskShadowNode.h \
     nodes/QskTextNode.h \
     nodes/QskTextRenderer.h \
     nodes/QskTextureNode.h \
     nodes/QskTextureRenderer.h \
     nodes/QskTickmarksNode.h \
+    nodes/QskTiledGraphicNode.h \
+    nodes/QskVectorGraphicNode.h \
     nodes/QskVertex.h
 
 SOURCES += \
@@ -113,11 +116,14 @@ SOURCES += \
     nodes/QskRichTextRenderer.cpp \
     nodes/QskScaleRenderer.cpp \
     nodes/QskSGNode.cpp \
+    nodes/QskShadowNode.cpp \
     nodes/QskTextNode.cpp \
     nodes/QskTextRenderer.cpp \
     nodes/QskTextureNode.cpp \
     nodes/QskTextureRenderer.cpp \
     nodes/QskTickmarksNode.cpp \
+    nodes/QskTiledGraphicNode.cpp \
+    nodes/QskVectorGraphicNode.cpp \
     nodes/QskVertex.cpp
 
 HEADERS += \
@@ -143,6 +149,8 @@ HEADERS += \
     controls/QskGraphicLabelSkinlet.h \
     controls/QskHintAnimator.h \
     controls/QskInputGrabber.h \
+    controls/QskItemBuilder.h \
+    controls/QskItemView.h \
     controls/QskListView.h \
     controls/QskListViewSkinlet.h \
     controls/QskObjectTree.h \
@@ -151,6 +159,7 @@ HEADERS += \
     controls/QskPanGestureRecognizer.h \
     controls/QskPopup.h \
     controls/QskPopupSkinlet.h \
+    controls/QskPrewarmer.h \
     controls/QskPushButton.h \
     controls/QskPushButtonSkinlet.h \
     controls/QskProgressBar.h \
@@ -158,6 +167,7 @@ HEADERS += \
     controls/QskQuick.h \
     controls/QskQuickItem.h \
     controls/QskQuickItemPrivate.h \
+    controls/QskSceneStatistics.h \
     controls/QskScrollArea.h \
     controls/QskScrollBox.h \
     controls/QskScrollView.h \
@@ -167,6 +177,7 @@ HEADERS += \
     controls/QskSetup.h \
     controls/QskShortcutMap.h \
     controls/QskSimpleListBox.h \
+    controls/QskSimpleListModel.h \
     controls/QskSkin.h \
     controls/QskSkinFactory.h \
     controls/QskSkinHintTable.h \
@@ -193,7 +204,8 @@ HEADERS += \
     controls/QskTextLabel.h \
     controls/QskTextLabelSkinlet.h \
     controls/QskVariantAnimator.h \
-    controls/QskWindow.h
+    controls/QskWindow.h \
+    controls/QskWindowPrivate.h
 
 SOURCES += \
     controls/QskAbstractButton.cpp \
@@ -217,6 +229,8 @@ SOURCES += \
     controls/QskGraphicLabelSkinlet.cpp \
     controls/QskHintAnimator.cpp \
     controls/QskInputGrabber.cpp \
+    controls/QskItemBuilder.cpp \
+    controls/QskItemView.cpp \
     controls/QskListView.cpp \
     controls/QskListViewSkinlet.cpp \
     controls/QskObjectTree.cpp \
@@ -225,6 +239,7 @@ SOURCES += \
     controls/QskPanGestureRecognizer.cpp \
     controls/QskPopup.cpp \
     controls/QskPopupSkinlet.cpp \
+    controls/QskPrewarmer.cpp \
     controls/QskPushButton.cpp \
     controls/QskPushButtonSkinlet.cpp \
     controls/QskProgressBar.cpp \
@@ -232,6 +247,7 @@ SOURCES += \
     controls/QskQuick.cpp \
     controls/QskQuickItem.cpp \
     controls/QskQuickItemPrivate.cpp \
+    controls/QskSceneStatistics.cpp \
     controls/QskScrollArea.cpp \
     controls/QskScrollBox.cpp \
     controls/QskScrollView.cpp \
@@ -241,6 +257,7 @@ SOURCES += \
     controls/QskSetup.cpp \
     controls/QskShortcutMap.cpp \
     controls/QskSimpleListBox.cpp \
+    controls/QskSimpleListModel.cpp \
     controls/QskSkin.cpp \
     controls/QskSkinHintTable.cpp \
     controls/QskSkinHintTableEditor.cpp \
@@ -321,7 +338,10 @@ HEADERS += \
     inputpanel/QskInputPanel.h \
     inputpanel/QskInputPanelBox.h \
     inputpanel/QskInputPredictionBar.h \
-    inputpanel/QskVirtualKeyboard.h
+    inputpanel/QskSimpleVirtualKeyboard.h \
+    inputpanel/QskSimpleVirtualKeyboardSkinlet.h \
+    inputpanel/QskVirtualKeyboard.h \
+    inputpanel/QskVirtualKeyboardLayout.h
 
 SOURCES += \
     inputpanel/QskTextPredictor.cpp \
@@ -329,7 +349,10 @@ SOURCES += \
     inputpanel/QskInputPanel.cpp \
     inputpanel/QskInputPanelBox.cpp \
     inputpanel/QskInputPredictionBar.cpp \
-    inputpanel/QskVirtualKeyboard.cpp
+    inputpanel/QskSimpleVirtualKeyboard.cpp \
+    inputpanel/QskSimpleVirtualKeyboardSkinlet.cpp \
+    inputpanel/QskVirtualKeyboard.cpp \
+    inputpanel/QskVirtualKeyboardLayout.cpp
 
 target.path    = $${QSK_INSTALL_LIBS}
 INSTALLS       = target
@@ -8,6 +8,24 @@
 #include <QskGraphic.h>
 #include <QPen>
 #include <QPainter>
+#include <QStringList>
+
+QStringList SkinnyShapeProvider::graphicIds() const
+{
+    return
+    {
+        QStringLiteral( "rectangle/royalblue" ),
+        QStringLiteral( "diamond/orange" ),
+        QStringLiteral( "triangledown/indianred" ),
+        QStringLiteral( "triangleup/paleturquoise" ),
+        QStringLiteral( "triangleleft/darkorchid" ),
+        QStringLiteral( "triangleright/thistle" ),
+        QStringLiteral( "ellipse/darkolivegreen" ),
+        QStringLiteral( "ring/sandybrown" ),
+        QStringLiteral( "star/darkviolet" ),
+        QStringLiteral( "hexagon/darkslategray" )
+    };
+}
 
 const QskGraphic* SkinnyShapeProvider::loadGraphic( const QString& id ) const
 {
@@ -11,6 +11,10 @@
 
 class SKINNY_EXPORT SkinnyShapeProvider : public QskGraphicProvider
 {
+  public:
+    // all shapes in their default colors
+    QStringList graphicIds() const override;
+
   protected:
     const QskGraphic* loadGraphic( const QString& id ) const override final;
 };
@@ -13,6 +13,7 @@
 #else
 #include <QskGraphicIO.h>
 #include <QskGraphic.h>
+#include <QskPainterCommand.h>
 #endif
 
 #include <QGuiApplication>
@@ -20,14 +21,500 @@
 #include <QPainter>
 #include <QDebug>
 
+#include <QCryptographicHash>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QRunnable>
+#include <QTextStream>
+#include <QThreadPool>
+
+#include <cstdio>
+
+/*
+    Has to be increased, when the conversion itself changes, so that
+    the outputs of previous runs are not taken from the hash cache
+ */
+static const char qskConverterVersion[] = "2";
+
 static void usage( const char* appName )
 {
     qWarning() << "usage: " << appName << "svgfile qvgfile";
+    qWarning() << "       " << appName
+        << "[-j jobs] [-optimize] [-validate] [-force] -o dir"
+        << "{ svgfile | directory | @listfile } ...";
+}
+
+namespace
+{
+    class Options
+    {
+      public:
+        QString outputDir;
+        int jobs = 0;
+
+        bool optimize = false;
+        bool validate = false; // reading the QVG back and comparing
+        bool force = false;    // ignoring the hash cache
+    };
+
+    class Job
+    {
+      public:
+        QString svgFile;
+        QString qvgFile;
+        QByteArray hash;
+    };
+
+    class Result
+    {
+      public:
+        bool ok = false;
+        bool skipped = false;
+
+        int commandCount = 0;
+        qint64 size = 0;
+
+        QStringList warnings;
+    };
+}
+
+static QskGraphic qskLoadGraphic( const QString& svgFile, bool* ok )
+{
+    /*
+        QSvgRenderer and QskGraphic can be used from any thread,
+        as long as each instance is used from one thread only.
+     */
+    QskGraphic graphic;
+
+    QSvgRenderer renderer;
+    *ok = renderer.load( svgFile );
+
+    if ( *ok )
+    {
+        QPainter painter( &graphic );
+        renderer.render( &painter );
+        painter.end();
+    }
+
+    return graphic;
+}
+
+static QskGraphic qskOptimized( const QskGraphic& graphic )
+{
+    /*
+        Dropping state changes, that do not change anything:
+        setting the same state again is a noop
+     */
+
+    const auto& commands = graphic.commands();
+
+    QVector< QskPainterCommand > optimized;
+    optimized.reserve( commands.size() );
+
+    QskPainterCommand lastState;
+
+    for ( const auto& command : commands )
+    {
+        const auto cmd = command.toCommand();
+
+        if ( cmd.type() == QskPainterCommand::State )
+        {
+            if ( cmd.stateData()->flags == 0 || cmd == lastState )
+                continue;
+
+            lastState = cmd;
+        }
+
+        optimized += cmd;
+    }
+
+    if ( optimized.size() == commands.size() )
+        return graphic;
+
+    QskGraphic optimizedGraphic;
+    optimizedGraphic.setCommands( optimized );
+    optimizedGraphic.setRenderHint( QskGraphic::RenderPensUnscaled,
+        graphic.testRenderHint( QskGraphic::RenderPensUnscaled ) );
+
+    return optimizedGraphic;
+}
+
+static Result qskConvert( const Job& job, const Options& options )
+{
+    Result result;
+
+    QskGraphic graphic = qskLoadGraphic( job.svgFile, &result.ok );
+    if ( !result.ok )
+    {
+        result.warnings += QStringLiteral( "can't be loaded" );
+        return result;
+    }
+
+    if ( options.optimize )
+        graphic = qskOptimized( graphic );
+
+    result.commandCount = graphic.commands().size();
+
+    if ( graphic.commandTypes() & QskGraphic::RasterData )
+        result.warnings += QStringLiteral( "contains non scalable parts" );
+
+    if ( graphic.isEmpty() )
+        result.warnings += QStringLiteral( "is empty" );
+
+    QByteArray data;
+    QskGraphicIO::write( graphic, data );
+
+    result.size = data.size();
+
+    const bool hasOutput = !job.qvgFile.isEmpty();
+
+    if ( hasOutput )
+    {
+        QFileInfo( job.qvgFile ).absoluteDir().mkpath( QStringLiteral( "." ) );
+
+        QFile file( job.qvgFile );
+        result.ok = file.open( QIODevice::WriteOnly )
+            && ( file.write( data ) == data.size() );
+
+        if ( !result.ok )
+        {
+            result.warnings += QStringLiteral( "can't write " ) + job.qvgFile;
+            return result;
+        }
+    }
+
+    if ( options.validate )
+    {
+        /*
+            Reading the QVG back - from the file, when having one - and
+            writing it again has to result in exactly the same data
+         */
+        const auto readBack = hasOutput
+            ? QskGraphicIO::read( job.qvgFile ) : QskGraphicIO::read( data );
+
+        QByteArray readBackData;
+        QskGraphicIO::write( readBack, readBackData );
+
+        if ( readBack.commands().size() != graphic.commands().size()
+            || readBackData != data )
+        {
+            result.ok = false;
+            result.warnings += QStringLiteral( "differs, when being read back" );
+        }
+    }
+
+    return result;
+}
+
+static QByteArray qskJobHash( const QString& svgFile, const Options& options )
+{
+    QFile file( svgFile );
+    if ( !file.open( QIODevice::ReadOnly ) )
+        return QByteArray();
+
+    QCryptographicHash hash( QCryptographicHash::Sha1 );
+    hash.addData( &file );
+
+    // the same SVG results in a different QVG, when these are different
+    hash.addData( QByteArray( qskConverterVersion ) );
+    hash.addData( QByteArray( QSK_VERSION_STR ) );
+    hash.addData( QByteArray( options.optimize ? "optimize" : "" ) );
+
+    return hash.result().toHex();
+}
+
+namespace
+{
+    /*
+        The hashes of the SVGs, that have been converted before - including
+        the options and the version of the converter. Stored as
+        "hash qvgfile" lines in the output directory.
+     */
+    class HashCache
+    {
+      public:
+        HashCache( const QString& dir )
+            : m_fileName( QDir( dir ).filePath( QStringLiteral( ".svg2qvg" ) ) )
+        {
+            QFile file( m_fileName );
+            if ( file.open( QIODevice::ReadOnly | QIODevice::Text ) )
+            {
+                while ( !file.atEnd() )
+                {
+                    const auto line = file.readLine().trimmed();
+
+                    const int pos = line.indexOf( ' ' );
+                    if ( pos > 0 )
+                        m_hashes.insert( QString::fromUtf8( line.mid( pos + 1 ) ), line.left( pos ) );
+                }
+            }
+        }
+
+        bool isUpToDate( const Job& job ) const
+        {
+            QMutexLocker locker( &m_mutex );
+
+            return m_hashes.value( job.qvgFile ) == job.hash
+                && QFileInfo::exists( job.qvgFile );
+        }
+
+        void update( const Job& job, bool ok )
+        {
+            QMutexLocker locker( &m_mutex );
+
+            if ( ok )
+                m_hashes.insert( job.qvgFile, job.hash );
+            else
+                m_hashes.remove( job.qvgFile );
+        }
+
+        void save() const
+        {
+            QFile file( m_fileName );
+            if ( file.open( QIODevice::WriteOnly | QIODevice::Text ) )
+            {
+                for ( auto it = m_hashes.constBegin(); it != m_hashes.constEnd(); ++it )
+                    file.write( it.value() + ' ' + it.key().toUtf8() + '\n' );
+            }
+        }
+
+      private:
+        const QString m_fileName;
+
+        mutable QMutex m_mutex;
+        QHash< QString, QByteArray > m_hashes;
+    };
+
+    class Reporter
+    {
+      public:
+        void report( const Job& job, const Result& result )
+        {
+            QMutexLocker locker( &m_mutex );
+
+            if ( !result.ok )
+                m_failed++;
+
+            if ( result.skipped )
+            {
+                m_skipped++;
+                return;
+            }
+
+            QTextStream out( stdout );
+            out << job.svgFile << ": " << result.commandCount << " commands, "
+                << result.size << " bytes\n";
+
+            for ( const auto& warning : result.warnings )
+                qWarning().noquote() << job.svgFile << warning;
+
+            m_converted++;
+        }
+
+        int failed() const { return m_failed; }
+
+        void summary() const
+        {
+            QTextStream out( stdout );
+            out << m_converted << " converted, " << m_skipped << " unchanged, "
+                << m_failed << " failed\n";
+        }
+
+      private:
+        QMutex m_mutex;
+
+        int m_converted = 0;
+        int m_skipped = 0;
+        int m_failed = 0;
+    };
+
+    class Runnable final : public QRunnable
+    {
+      public:
+        Runnable( const Job& job, const Options& options,
+                HashCache* cache, Reporter* reporter )
+            : m_job( job )
+            , m_options( options )
+            , m_cache( cache )
+            , m_reporter( reporter )
+        {
+        }
+
+        void run() override
+        {
+            Result result;
+
+            const bool useCache = !( m_options.force || m_options.validate );
+
+            if ( m_cache && useCache && m_cache->isUpToDate( m_job ) )
+            {
+                result.ok = true;
+                result.skipped = true;
+            }
+            else
+            {
+                result = qskConvert( m_job, m_options );
+
+                if ( m_cache )
+                    m_cache->update( m_job, result.ok );
+            }
+
+            m_reporter->report( m_job, result );
+        }
+
+      private:
+        const Job m_job;
+        const Options& m_options;
+
+        HashCache* m_cache;
+        Reporter* m_reporter;
+    };
+}
+
+static void qskAppendJobs( const QString& input,
+    const QString& outputDir, QVector< Job >& jobs )
+{
+    if ( input.startsWith( QLatin1Char( '@' ) ) )
+    {
+        QFile file( input.mid( 1 ) );
+        if ( !file.open( QIODevice::ReadOnly | QIODevice::Text ) )
+        {
+            qWarning() << "can't open" << file.fileName();
+            return;
+        }
+
+        while ( !file.atEnd() )
+        {
+            const auto line = QString::fromUtf8( file.readLine().trimmed() );
+            if ( !line.isEmpty() )
+                qskAppendJobs( line, outputDir, jobs );
+        }
+
+        return;
+    }
+
+    const QFileInfo info( input );
+    const QDir dir( outputDir );
+
+    if ( info.isDir() )
+    {
+        const QDir inputDir( input );
+
+        QDirIterator it( input, { QStringLiteral( "*.svg" ) },
+            QDir::Files, QDirIterator::Subdirectories );
+
+        while ( it.hasNext() )
+        {
+            Job job;
+            job.svgFile = it.next();
+
+            auto path = inputDir.relativeFilePath( job.svgFile );
+            path.chop( 4 );
+
+            job.qvgFile = dir.filePath( path + QStringLiteral( ".qvg" ) );
+
+            jobs += job;
+        }
+    }
+    else
+    {
+        Job job;
+        job.svgFile = input;
+        job.qvgFile = dir.filePath( info.completeBaseName() + QStringLiteral( ".qvg" ) );
+
+        jobs += job;
+    }
+}
+
+static bool qskCheckOutputs( QVector< Job >& jobs )
+{
+    /*
+        Different inputs with the same basename would be written
+        to the same output. Inputs, that have been passed more than
+        once, are converted only once.
+     */
+    QHash< QString, QString > outputs;
+    QVector< Job > uniqueJobs;
+
+    bool ok = true;
+
+    for ( const auto& job : qskAsConst( jobs ) )
+    {
+        const auto qvgFile = QFileInfo( job.qvgFile ).absoluteFilePath();
+
+        const auto it = outputs.constFind( qvgFile );
+        if ( it == outputs.constEnd() )
+        {
+            outputs.insert( qvgFile, job.svgFile );
+            uniqueJobs += job;
+        }
+        else if ( QFileInfo( it.value() ) != QFileInfo( job.svgFile ) )
+        {
+            qWarning().noquote() << it.value() << "and" << job.svgFile
+                << "would both be written to" << job.qvgFile;
+
+            ok = false;
+        }
+    }
+
+    jobs = uniqueJobs;
+    return ok;
+}
+
+static int qskBatch( const Options& options, const QStringList& inputs )
+{
+    QVector< Job > jobs;
+    for ( const auto& input : inputs )
+        qskAppendJobs( input, options.outputDir, jobs );
+
+    HashCache* cache = nullptr;
+
+    if ( options.outputDir.isEmpty() )
+    {
+        // validating only: nothing is written
+        for ( auto& job : jobs )
+            job.qvgFile.clear();
+    }
+    else
+    {
+        if ( !qskCheckOutputs( jobs ) )
+            return -1;
+
+        cache = new HashCache( options.outputDir );
+
+        for ( auto& job : jobs )
+            job.hash = qskJobHash( job.svgFile, options );
+    }
+
+    Reporter reporter;
+
+    QThreadPool pool;
+    if ( options.jobs > 0 )
+        pool.setMaxThreadCount( options.jobs );
+
+    for ( const auto& job : qskAsConst( jobs ) )
+        pool.start( new Runnable( job, options, cache, &reporter ) );
+
+    pool.waitForDone();
+
+    if ( cache )
+    {
+        cache->save();
+        delete cache;
+    }
+
+    reporter.summary();
+
+    return reporter.failed() > 0 ? -2 : 0;
 }
 
 int main( int argc, char* argv[] )
 {
-    if ( argc != 3 )
+    if ( argc < 3 )
     {
         usage( argv[0] );
         return -1;
@@ -47,25 +534,62 @@ int main( int argc, char* argv[] )
         When having a SVG with specific font assignments Qt runs on
         qGuiApp to load a default font. Makes no sense in this context,
         but to avoid having segfaults ...
+
+        The application is created once for all files and the
+        conversions are done in worker threads.
      */
     QGuiApplication app( argc, argv );
 #endif
 
-    QSvgRenderer renderer;
-    if ( !renderer.load( QString( argv[1] ) ) )
-        return -2;
+    Options options;
+    QStringList inputs;
 
-    QskGraphic graphic;
+    const auto args = app.arguments();
+    for ( int i = 1; i < args.size(); i++ )
+    {
+        const auto& arg = args[ i ];
 
-    QPainter painter( &graphic );
-    renderer.render( &painter );
-    painter.end();
+        if ( arg == QStringLiteral( "-o" ) && i + 1 < args.size() )
+            options.outputDir = args[ ++i ];
+        else if ( arg == QStringLiteral( "-j" ) && i + 1 < args.size() )
+            options.jobs = args[ ++i ].toInt();
+        else if ( arg == QStringLiteral( "-optimize" ) )
+            options.optimize = true;
+        else if ( arg == QStringLiteral( "-validate" ) )
+            options.validate = true;
+        else if ( arg == QStringLiteral( "-force" ) )
+            options.force = true;
+        else
+            inputs += arg;
+    }
 
-    if ( graphic.commandTypes() & QskGraphic::RasterData )
-        qWarning() << argv[1] << "contains non scalable parts.";
+    if ( options.outputDir.isEmpty() && !options.validate )
+    {
+        // the classic mode: svgfile qvgfile
 
-    QskGraphicIO::write( graphic, argv[2] );
+        if ( inputs.size() != 2 )
+        {
+            usage( argv[0] );
+            return -1;
+        }
 
-    return 0;
-}
+        Job job;
+        job.svgFile = inputs[0];
+        job.qvgFile = inputs[1];
+
+        const auto result = qskConvert( job, options );
+
+        for ( const auto& warning : result.warnings )
+            qWarning().noquote() << job.svgFile << warning;
 
+        return result.ok ? 0 : -2;
+    }
+
+    if ( inputs.isEmpty() )
+    {
+        usage( argv[0] );
+        return -1;
+    }
+
+    return qskBatch( options, inputs );
+}